@@ -0,0 +1,57 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+#define INDEX_APPEND_ROWS         1000000
+#define INDEX_APPEND_TRANSACTIONS 1000
+
+#define INDEX_APPEND_BENCHMARK(CLIENTS)                                                                                \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE integers(i BIGINT PRIMARY KEY, j BIGINT)");                                    \
+		state->conn.Query("INSERT INTO integers SELECT range * 2, range FROM range(" +                                 \
+		                  to_string(INDEX_APPEND_ROWS) + ")");                                                         \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<std::thread> clients;                                                                                   \
+		/* every client commits its share of the transactions, each appends a disjoint range of odd keys */            \
+		idx_t rows_per_transaction = INDEX_APPEND_ROWS / INDEX_APPEND_TRANSACTIONS;                                    \
+		for (idx_t c = 0; c < CLIENTS; c++) {                                                                          \
+			clients.emplace_back([state, c, rows_per_transaction]() {                                                  \
+				Connection conn(state->db);                                                                            \
+				for (idx_t t = c; t < INDEX_APPEND_TRANSACTIONS; t += CLIENTS) {                                       \
+					auto start = t * rows_per_transaction;                                                             \
+					conn.Query("INSERT INTO integers SELECT range * 2 + 1, range FROM range(" + to_string(start) +     \
+					           ", " + to_string(start + rows_per_transaction) + ")");                                  \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &client : clients) {                                                                                 \
+			client.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DROP TABLE integers");                                                                      \
+		Load(state);                                                                                                   \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Commit 1000 INSERT transactions into a table with a PRIMARY KEY from " + to_string(CLIENTS) +          \
+		       " concurrent clients";                                                                                  \
+	}
+
+DUCKDB_BENCHMARK(IndexAppend1Client, "[index_append]")
+INDEX_APPEND_BENCHMARK(1);
+FINISH_BENCHMARK(IndexAppend1Client)
+
+DUCKDB_BENCHMARK(IndexAppend4Clients, "[index_append]")
+INDEX_APPEND_BENCHMARK(4);
+FINISH_BENCHMARK(IndexAppend4Clients)
+
+DUCKDB_BENCHMARK(IndexAppend8Clients, "[index_append]")
+INDEX_APPEND_BENCHMARK(8);
+FINISH_BENCHMARK(IndexAppend8Clients)
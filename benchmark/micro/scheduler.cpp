@@ -0,0 +1,53 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+#define SCHEDULER_SHORT_CLIENTS 8
+#define SCHEDULER_SHORT_QUERIES 250
+#define SCHEDULER_LONG_QUERIES  4
+
+#define SCHEDULER_MIX_BENCHMARK(WORK_STEALING)                                                                         \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query(string("SET enable_work_stealing=") + (WORK_STEALING ? "true" : "false"));                   \
+		state->conn.Query("CREATE TABLE small_tbl AS SELECT range AS i, range % 100 AS g FROM range(100000)");         \
+		state->conn.Query("CREATE TABLE large_tbl AS SELECT range AS i, range % 1000 AS g FROM range(50000000)");      \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<std::thread> clients;                                                                                   \
+		/* one client runs a few long aggregates */                                                                    \
+		clients.emplace_back([state]() {                                                                               \
+			Connection conn(state->db);                                                                                \
+			for (idx_t q = 0; q < SCHEDULER_LONG_QUERIES; q++) {                                                       \
+				conn.Query("SELECT g, SUM(i) FROM large_tbl GROUP BY g");                                              \
+			}                                                                                                          \
+		});                                                                                                            \
+		/* the other clients run many short queries at the same time */                                                \
+		for (idx_t c = 0; c < SCHEDULER_SHORT_CLIENTS; c++) {                                                          \
+			clients.emplace_back([state, c]() {                                                                        \
+				Connection conn(state->db);                                                                            \
+				for (idx_t q = 0; q < SCHEDULER_SHORT_QUERIES; q++) {                                                  \
+					conn.Query("SELECT SUM(i) FROM small_tbl WHERE g = " + to_string((c + q) % 100));                  \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &client : clients) {                                                                                 \
+			client.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Run many short queries from several clients while another client runs a few long aggregates";          \
+	}
+
+DUCKDB_BENCHMARK(SchedulerMixedQueries, "[scheduler]")
+SCHEDULER_MIX_BENCHMARK(false);
+FINISH_BENCHMARK(SchedulerMixedQueries)
+
+DUCKDB_BENCHMARK(SchedulerMixedQueriesWorkStealing, "[scheduler]")
+SCHEDULER_MIX_BENCHMARK(true);
+FINISH_BENCHMARK(SchedulerMixedQueriesWorkStealing)
@@ -19,6 +19,7 @@ unique_ptr<CreateInfo> IndexCatalogEntry::GetInfo() const {
 	result->sql = sql;
 	result->index_name = name;
 	result->index_type = index_type;
+	result->options = options;
 	result->constraint_type = index_constraint_type;
 	result->column_ids = column_ids;
 
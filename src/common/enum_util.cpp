@@ -15,6 +15,7 @@
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
@@ -26,6 +27,7 @@
 #include "duckdb/common/enums/file_glob_options.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 #include "duckdb/common/enums/index_constraint_type.hpp"
+#include "duckdb/common/enums/join_hashtable_layout.hpp"
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/enums/joinref_type.hpp"
 #include "duckdb/common/enums/logical_operator_type.hpp"
@@ -125,6 +127,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/chunk_info.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/verification/statement_verifier.hpp"
 
 namespace duckdb {
@@ -688,6 +691,29 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value) {
+	switch(value) {
+	case BufferEvictionPolicy::LRU:
+		return "LRU";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "TWO_QUEUE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return BufferEvictionPolicy::LRU;
+	}
+	if (StringUtil::Equals(value, "TWO_QUEUE")) {
+		return BufferEvictionPolicy::TWO_QUEUE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value) {
 	switch(value) {
@@ -1629,6 +1655,29 @@ ErrorType EnumUtil::FromString<ErrorType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<EvictionQueueType>(EvictionQueueType value) {
+	switch(value) {
+	case EvictionQueueType::RECENT:
+		return "RECENT";
+	case EvictionQueueType::FREQUENT:
+		return "FREQUENT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionQueueType EnumUtil::FromString<EvictionQueueType>(const char *value) {
+	if (StringUtil::Equals(value, "RECENT")) {
+		return EvictionQueueType::RECENT;
+	}
+	if (StringUtil::Equals(value, "FREQUENT")) {
+		return EvictionQueueType::FREQUENT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value) {
 	switch(value) {
@@ -2975,6 +3024,34 @@ InterruptMode EnumUtil::FromString<InterruptMode>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<JoinHashTableLayout>(JoinHashTableLayout value) {
+	switch(value) {
+	case JoinHashTableLayout::AUTOMATIC:
+		return "AUTOMATIC";
+	case JoinHashTableLayout::CHAINED:
+		return "CHAINED";
+	case JoinHashTableLayout::LINEAR_PROBING:
+		return "LINEAR_PROBING";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+JoinHashTableLayout EnumUtil::FromString<JoinHashTableLayout>(const char *value) {
+	if (StringUtil::Equals(value, "AUTOMATIC")) {
+		return JoinHashTableLayout::AUTOMATIC;
+	}
+	if (StringUtil::Equals(value, "CHAINED")) {
+		return JoinHashTableLayout::CHAINED;
+	}
+	if (StringUtil::Equals(value, "LINEAR_PROBING")) {
+		return JoinHashTableLayout::LINEAR_PROBING;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<JoinRefType>(JoinRefType value) {
 	switch(value) {
@@ -4637,6 +4714,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -4693,6 +4772,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -4807,6 +4888,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -4891,6 +4975,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -6555,6 +6642,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6580,6 +6669,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -6735,6 +6827,64 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value) {
+	switch(value) {
+	case TemporaryBufferSize::INVALID:
+		return "INVALID";
+	case TemporaryBufferSize::S32K:
+		return "S32K";
+	case TemporaryBufferSize::S64K:
+		return "S64K";
+	case TemporaryBufferSize::S96K:
+		return "S96K";
+	case TemporaryBufferSize::S128K:
+		return "S128K";
+	case TemporaryBufferSize::S160K:
+		return "S160K";
+	case TemporaryBufferSize::S192K:
+		return "S192K";
+	case TemporaryBufferSize::S224K:
+		return "S224K";
+	case TemporaryBufferSize::DEFAULT:
+		return "DEFAULT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value) {
+	if (StringUtil::Equals(value, "INVALID")) {
+		return TemporaryBufferSize::INVALID;
+	}
+	if (StringUtil::Equals(value, "S32K")) {
+		return TemporaryBufferSize::S32K;
+	}
+	if (StringUtil::Equals(value, "S64K")) {
+		return TemporaryBufferSize::S64K;
+	}
+	if (StringUtil::Equals(value, "S96K")) {
+		return TemporaryBufferSize::S96K;
+	}
+	if (StringUtil::Equals(value, "S128K")) {
+		return TemporaryBufferSize::S128K;
+	}
+	if (StringUtil::Equals(value, "S160K")) {
+		return TemporaryBufferSize::S160K;
+	}
+	if (StringUtil::Equals(value, "S192K")) {
+		return TemporaryBufferSize::S192K;
+	}
+	if (StringUtil::Equals(value, "S224K")) {
+		return TemporaryBufferSize::S224K;
+	}
+	if (StringUtil::Equals(value, "DEFAULT")) {
+		return TemporaryBufferSize::DEFAULT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
@@ -0,0 +1,113 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#include <sched.h>
+#define DUCKDB_NUMA_SUPPORTED
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_NUMA_SUPPORTED
+static bool ReadSysFile(FileSystem &fs, const string &path, string &result) {
+	if (!fs.FileExists(path)) {
+		return false;
+	}
+	char byte_buffer[4096];
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	auto read_bytes = fs.Read(*handle, (void *)byte_buffer, sizeof(byte_buffer) - 1);
+	byte_buffer[read_bytes] = '\0';
+	result = byte_buffer;
+	StringUtil::Trim(result);
+	return true;
+}
+#endif
+
+NumaTopology::NumaTopology() {
+#ifdef DUCKDB_NUMA_SUPPORTED
+	static constexpr const char *NODE_PATH = "/sys/devices/system/node/";
+	LocalFileSystem fs;
+	string online;
+	if (ReadSysFile(fs, string(NODE_PATH) + "online", online)) {
+		for (auto node : ParseCPUList(online)) {
+			string cpu_list;
+			if (!ReadSysFile(fs, StringUtil::Format("%snode%llu/cpulist", NODE_PATH, node), cpu_list)) {
+				continue;
+			}
+			auto cpus = ParseCPUList(cpu_list);
+			if (cpus.empty()) {
+				// memory-only node
+				continue;
+			}
+			for (auto cpu : cpus) {
+				if (cpu >= cpu_nodes.size()) {
+					cpu_nodes.resize(cpu + 1, 0);
+				}
+				cpu_nodes[cpu] = node_cpus.size();
+			}
+			node_cpus.push_back(std::move(cpus));
+		}
+	}
+#endif
+	if (node_cpus.empty()) {
+		// unknown topology: a single node without CPU information
+		node_cpus.emplace_back();
+	}
+}
+
+const NumaTopology &NumaTopology::Get() {
+	static NumaTopology topology;
+	return topology;
+}
+
+idx_t NumaTopology::NodeCount() const {
+	return node_cpus.size();
+}
+
+bool NumaTopology::BindThread(idx_t node) const {
+#ifdef DUCKDB_NUMA_SUPPORTED
+	auto &cpus = node_cpus[node % node_cpus.size()];
+	if (cpus.empty()) {
+		return false;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : cpus) {
+		CPU_SET(cpu, &cpu_set);
+	}
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+idx_t NumaTopology::CurrentNode() const {
+#ifdef DUCKDB_NUMA_SUPPORTED
+	auto cpu = sched_getcpu();
+	if (cpu >= 0 && idx_t(cpu) < cpu_nodes.size()) {
+		return cpu_nodes[idx_t(cpu)];
+	}
+#endif
+	return 0;
+}
+
+vector<idx_t> NumaTopology::ParseCPUList(const string &list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(list, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		if (bounds.empty() || bounds.size() > 2) {
+			continue;
+		}
+		idx_t start = std::stoull(bounds[0]);
+		idx_t end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -88,14 +88,16 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		// Store heap pointers
 		data_ptr_t l_heap_ptr = left.HeapPtr(*left.sb->blob_sorting_data);
 		data_ptr_t r_heap_ptr = right.HeapPtr(*right.sb->blob_sorting_data);
-		// Unswizzle offset to pointer
-		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
-		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
+		// Unswizzle offset to pointer in copies of the values, so that threads can compare the same rows concurrently
+		const idx_t value_size = type.InternalType() == PhysicalType::VARCHAR ? sizeof(string_t) : sizeof(data_ptr_t);
+		data_t l_value[sizeof(string_t)];
+		data_t r_value[sizeof(string_t)];
+		memcpy(l_value, l_data_ptr, value_size);
+		memcpy(r_value, r_data_ptr, value_size);
+		UnswizzleSingleValue(l_value, l_heap_ptr, type);
+		UnswizzleSingleValue(r_value, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
-		// Swizzle the pointers back to offsets
-		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
-		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
+		result = CompareVal(l_value, r_value, type);
 	} else {
 		result = CompareVal(l_data_ptr, r_data_ptr, type);
 	}
@@ -660,4 +660,333 @@ void MergeSorter::FlushBlobs(const RowLayout &layout, const idx_t &source_count,
 	D_ASSERT(target_heap_block.byte_offset <= target_heap_block.capacity);
 }
 
+KWayMergeSorter::KWayMergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
+    : state(state), buffer_manager(buffer_manager), sort_layout(state.sort_layout) {
+}
+
+void KWayMergeSorter::ComputeSplitters() {
+	// Initialize the readers that are used to find the partition boundaries, the sorted blocks are only read
+	for (auto &sb : state.sorted_blocks) {
+		block_scans.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		block_scans.back()->sb = sb.get();
+	}
+	block_counts = state.partition_bounds.back();
+	while (true) {
+		idx_t splitter_idx;
+		{
+			lock_guard<mutex> splitter_guard(state.lock);
+			if (state.splitter_idx >= state.num_partitions) {
+				break;
+			}
+			splitter_idx = state.splitter_idx++;
+		}
+		// The boundary is computed outside of the lock, every thread writes the boundaries that it claimed
+		GetSplitters(splitter_idx * state.block_capacity, state.partition_bounds[splitter_idx]);
+	}
+}
+
+void KWayMergeSorter::PerformKWayMerge() {
+	while (true) {
+		{
+			lock_guard<mutex> partition_guard(state.lock);
+			if (state.partition_idx == state.num_partitions) {
+				break;
+			}
+			GetNextPartition();
+		}
+		MergePartition();
+	}
+}
+
+void KWayMergeSorter::GetNextPartition() {
+	const auto partition_idx = state.partition_idx++;
+	// Create result block
+	state.sorted_blocks_temp[0][partition_idx] = make_uniq<SortedBlock>(buffer_manager, state);
+	result = state.sorted_blocks_temp[0][partition_idx].get();
+	// Take the slices of the data that this thread must merge
+	input_blocks = std::move(state.partition_slices[partition_idx]);
+	input_starts = std::move(state.partition_slice_starts[partition_idx]);
+	inputs.clear();
+	for (idx_t input_idx = 0; input_idx < input_blocks.size(); input_idx++) {
+		inputs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		inputs.back()->sb = input_blocks[input_idx].get();
+		inputs.back()->SetIndices(0, input_starts[input_idx]);
+	}
+}
+
+void KWayMergeSorter::GetSplitters(const idx_t rank, vector<idx_t> &splitters) {
+	// Rows are ordered by their sort key, and equal rows by the index of their sorted block
+	// The splitter of each sorted block is the number of its rows among the 'rank' first rows of this order
+	// We keep a range [lo, hi] that contains the splitter for each sorted block, and narrow the ranges by computing
+	// the rank of the middle row of the widest range, until all ranges are empty
+	const idx_t block_count = block_counts.size();
+	vector<idx_t> lo(block_count, 0);
+	vector<idx_t> hi = block_counts;
+	vector<idx_t> preceding(block_count);
+	while (true) {
+		idx_t pivot_block_idx = block_count;
+		idx_t widest = 0;
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			if (hi[block_idx] - lo[block_idx] > widest) {
+				pivot_block_idx = block_idx;
+				widest = hi[block_idx] - lo[block_idx];
+			}
+		}
+		if (pivot_block_idx == block_count) {
+			break;
+		}
+		// Compute the rank of the pivot row
+		const idx_t pivot_idx = lo[pivot_block_idx] + widest / 2;
+		idx_t pivot_rank = 0;
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			if (block_idx == pivot_block_idx) {
+				preceding[block_idx] = pivot_idx;
+			} else {
+				preceding[block_idx] = CountPreceding(block_idx, pivot_block_idx, pivot_idx);
+			}
+			pivot_rank += preceding[block_idx];
+		}
+		if (pivot_rank < rank) {
+			// The pivot row and all rows that precede it belong to the partition
+			for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+				lo[block_idx] = MaxValue(lo[block_idx], preceding[block_idx]);
+			}
+			lo[pivot_block_idx] = pivot_idx + 1;
+		} else {
+			// The pivot row does not belong to the partition, nor do the rows that follow it
+			for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+				hi[block_idx] = MinValue(hi[block_idx], preceding[block_idx]);
+			}
+		}
+	}
+	splitters = std::move(lo);
+#ifdef DEBUG
+	idx_t splitter_sum = 0;
+	for (auto &splitter : splitters) {
+		splitter_sum += splitter;
+	}
+	D_ASSERT(splitter_sum == rank);
+#endif
+}
+
+idx_t KWayMergeSorter::CountPreceding(const idx_t block_idx, const idx_t pivot_block_idx, const idx_t pivot_idx) {
+	auto &scan = *block_scans[block_idx];
+	auto &pivot_scan = *block_scans[pivot_block_idx];
+	idx_t lo = 0;
+	idx_t hi = block_counts[block_idx];
+	while (lo < hi) {
+		const idx_t middle = lo + (hi - lo) / 2;
+		const int comp_res = CompareUsingGlobalIndex(scan, pivot_scan, middle, pivot_idx);
+		if (comp_res < 0 || (comp_res == 0 && block_idx < pivot_block_idx)) {
+			lo = middle + 1;
+		} else {
+			hi = middle;
+		}
+	}
+	return lo;
+}
+
+int KWayMergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
+	D_ASSERT(l_idx < l.sb->Count());
+	D_ASSERT(r_idx < r.sb->Count());
+
+	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
+	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
+
+	l.PinRadix(l.block_idx);
+	r.PinRadix(r.block_idx);
+	data_ptr_t l_ptr = l.RadixPtr();
+	data_ptr_t r_ptr = r.RadixPtr();
+
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l_ptr, r_ptr, sort_layout.comparison_size);
+	} else {
+		l.PinData(*l.sb->blob_sorting_data);
+		r.PinData(*r.sb->blob_sorting_data);
+		comp_res = Comparators::CompareTuple(l, r, l_ptr, r_ptr, sort_layout, state.external);
+	}
+	return comp_res;
+}
+
+void KWayMergeSorter::MergePartition() {
+	// Set up the write block
+	// Each merge task produces a SortedBlock with exactly state.block_capacity rows or less
+	result->InitializeWrite();
+	auto &result_radix_block = *result->radix_sorting_data.back();
+	auto result_radix_handle = buffer_manager.Pin(result_radix_block.block);
+	data_ptr_t result_radix_ptr = result_radix_handle.Ptr();
+	BufferHandle result_blob_handle;
+	BufferHandle result_blob_heap_handle;
+	if (!sort_layout.all_constant) {
+		result_blob_handle = buffer_manager.Pin(result->blob_sorting_data->data_blocks.back()->block);
+		if (!result->blob_sorting_data->layout.AllConstant() && state.external) {
+			result_blob_heap_handle = buffer_manager.Pin(result->blob_sorting_data->heap_blocks.back()->block);
+		}
+	}
+	auto result_payload_handle = buffer_manager.Pin(result->payload_data->data_blocks.back()->block);
+	BufferHandle result_payload_heap_handle;
+	if (!state.payload_layout.AllConstant() && state.external) {
+		result_payload_heap_handle = buffer_manager.Pin(result->payload_data->heap_blocks.back()->block);
+	}
+	// Pin the first row of each input
+	const idx_t input_count = inputs.size();
+	for (auto &input : inputs) {
+		input->PinRadix(input->block_idx);
+		if (!sort_layout.all_constant) {
+			input->PinData(*input->sb->blob_sorting_data);
+		}
+	}
+	// Build the loser tree: the leaves (inputs) are nodes [input_count, 2 * input_count) of a binary tree,
+	// and every internal node stores the input that lost the comparison at that node
+	vector<idx_t> losers(input_count);
+	vector<idx_t> winners(2 * input_count);
+	for (idx_t input_idx = 0; input_idx < input_count; input_idx++) {
+		winners[input_count + input_idx] = input_idx;
+	}
+	for (idx_t node = input_count - 1; node > 0; node--) {
+		const auto l = winners[2 * node];
+		const auto r = winners[2 * node + 1];
+		const bool l_smaller = InputSmaller(l, r);
+		winners[node] = l_smaller ? l : r;
+		losers[node] = l_smaller ? r : l;
+	}
+	idx_t winner = winners[1];
+	// Merge loop, which only touches the sorting keys
+	merged_inputs.clear();
+	while (true) {
+		auto &input = *inputs[winner];
+		if (input.block_idx == input.sb->radix_sorting_data.size()) {
+			// The smallest input is exhausted, so all inputs are: Done
+			break;
+		}
+		// Copy the sorting key of the smallest row to the result
+		D_ASSERT(result_radix_block.count < result_radix_block.capacity);
+		FastMemcpy(result_radix_ptr, input.RadixPtr(), sort_layout.entry_size);
+		result_radix_ptr += sort_layout.entry_size;
+		result_radix_block.count++;
+		if (!sort_layout.all_constant) {
+			AppendRow(*result->blob_sorting_data, *input.sb->blob_sorting_data, input, result_blob_handle,
+			          result_blob_heap_handle);
+		}
+		merged_inputs.push_back(winner);
+		AdvanceKeys(input);
+		// Replay the matches from the leaf of the winner up to the root
+		for (idx_t node = (winner + input_count) / 2; node > 0; node /= 2) {
+			if (InputSmaller(losers[node], winner)) {
+				std::swap(losers[node], winner);
+			}
+		}
+	}
+	// Gather the payload in the merged order, every input reads its payload rows from the start of its slice
+	for (idx_t input_idx = 0; input_idx < input_count; input_idx++) {
+		inputs[input_idx]->SetIndices(0, input_starts[input_idx]);
+	}
+	for (const auto &input_idx : merged_inputs) {
+		auto &input = *inputs[input_idx];
+		AppendRow(*result->payload_data, *input.sb->payload_data, input, result_payload_handle,
+		          result_payload_heap_handle);
+		AdvancePayload(input);
+	}
+	D_ASSERT(result->radix_sorting_data.size() == result->payload_data->data_blocks.size());
+	D_ASSERT(result->Count() <= state.block_capacity);
+}
+
+bool KWayMergeSorter::InputSmaller(const idx_t l, const idx_t r) {
+	auto &l_input = *inputs[l];
+	auto &r_input = *inputs[r];
+	const bool l_done = l_input.block_idx == l_input.sb->radix_sorting_data.size();
+	const bool r_done = r_input.block_idx == r_input.sb->radix_sorting_data.size();
+	if (l_done || r_done) {
+		// Exhausted inputs come last
+		return !l_done;
+	}
+	data_ptr_t l_ptr = l_input.RadixPtr();
+	data_ptr_t r_ptr = r_input.RadixPtr();
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l_ptr, r_ptr, sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(l_input, r_input, l_ptr, r_ptr, sort_layout, state.external);
+	}
+	// Equal rows are taken from the input with the lowest index first, like the partition boundaries
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+void KWayMergeSorter::AdvanceKeys(SBScanState &input) {
+	auto &radix_sorting_data = input.sb->radix_sorting_data;
+	input.entry_idx++;
+	while (input.block_idx < radix_sorting_data.size() &&
+	       input.entry_idx == radix_sorting_data[input.block_idx]->count) {
+		// Delete references to the finished block
+		radix_sorting_data[input.block_idx]->block = nullptr;
+		if (!sort_layout.all_constant) {
+			auto &blob_sorting_data = *input.sb->blob_sorting_data;
+			blob_sorting_data.data_blocks[input.block_idx]->block = nullptr;
+			if (!blob_sorting_data.layout.AllConstant() && state.external) {
+				blob_sorting_data.heap_blocks[input.block_idx]->block = nullptr;
+			}
+		}
+		// Advance block
+		input.block_idx++;
+		input.entry_idx = 0;
+	}
+	if (input.block_idx < radix_sorting_data.size()) {
+		// Pin the data needed to compare the next row
+		input.PinRadix(input.block_idx);
+		if (!sort_layout.all_constant) {
+			input.PinData(*input.sb->blob_sorting_data);
+		}
+	}
+}
+
+void KWayMergeSorter::AdvancePayload(SBScanState &input) {
+	auto &payload_data = *input.sb->payload_data;
+	input.entry_idx++;
+	while (input.block_idx < payload_data.data_blocks.size() &&
+	       input.entry_idx == payload_data.data_blocks[input.block_idx]->count) {
+		// Delete references to the finished block
+		payload_data.data_blocks[input.block_idx]->block = nullptr;
+		if (!payload_data.layout.AllConstant() && state.external) {
+			payload_data.heap_blocks[input.block_idx]->block = nullptr;
+		}
+		// Advance block
+		input.block_idx++;
+		input.entry_idx = 0;
+	}
+}
+
+void KWayMergeSorter::AppendRow(SortedData &result_data, SortedData &input_data, SBScanState &input,
+                                BufferHandle &result_handle, BufferHandle &result_heap_handle) {
+	const auto &layout = result_data.layout;
+	const idx_t row_width = layout.GetRowWidth();
+	auto &result_data_block = *result_data.data_blocks.back();
+	D_ASSERT(result_data_block.count < result_data_block.capacity);
+	data_ptr_t result_data_ptr = result_handle.Ptr() + result_data_block.count * row_width;
+	input.PinData(input_data);
+	FastMemcpy(result_data_ptr, input.DataPtr(input_data), row_width);
+	result_data_block.count++;
+	if (layout.AllConstant() || !state.external) {
+		// If all constant size, or if we are doing an in-memory sort, we do not need to touch the heap
+		return;
+	}
+	// External sorting with variable size data: copy the heap entry of the row too
+	auto &result_heap_block = *result_data.heap_blocks.back();
+	data_ptr_t heap_ptr = input.HeapPtr(input_data);
+	const auto entry_size = Load<uint32_t>(heap_ptr);
+	D_ASSERT(entry_size >= sizeof(uint32_t));
+	if (result_heap_block.byte_offset + entry_size > result_heap_block.capacity) {
+		// Grow the result heap block geometrically, rows are appended one at a time
+		idx_t new_capacity = MaxValue(result_heap_block.capacity * 2, result_heap_block.byte_offset + entry_size);
+		buffer_manager.ReAllocate(result_heap_block.block, new_capacity);
+		result_heap_block.capacity = new_capacity;
+	}
+	memcpy(result_heap_handle.Ptr() + result_heap_block.byte_offset, heap_ptr, entry_size);
+	// Store base heap offset in the row data
+	Store<idx_t>(result_heap_block.byte_offset, result_data_ptr + layout.GetHeapOffset());
+	result_heap_block.byte_offset += entry_size;
+	result_heap_block.count++;
+	D_ASSERT(result_data_block.count == result_heap_block.count);
+}
+
 } // namespace duckdb
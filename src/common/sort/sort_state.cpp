@@ -42,9 +42,21 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+static bool InlineString(optional_ptr<BaseStatistics> stats) {
+	return stats && StringStats::HasMaxStringLength(*stats) &&
+	       StringStats::MaxStringLength(*stats) <= SortConstants::MAX_INLINED_STRING_SIZE;
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
+	// Strings that are not inlined share the prefix budget, so that a single long string key gets a long prefix
+	idx_t prefixed_string_count = 0;
+	for (const auto &order : orders) {
+		if (order.expression->return_type.InternalType() == PhysicalType::VARCHAR && !InlineString(order.stats.get())) {
+			prefixed_string_count++;
+		}
+	}
 	for (idx_t i = 0; i < column_count; i++) {
 		const auto &order = orders[i];
 
@@ -70,15 +82,13 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
-			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
+			if (InlineString(stats.back())) {
+				// Short strings are inlined entirely, so ties never have to be broken by chasing the string heap
 				col_size += StringStats::MaxStringLength(*stats.back());
-				if (col_size > 12) {
-					col_size = 12;
-				} else {
-					constant_size.back() = true;
-				}
+				constant_size.back() = true;
 			} else {
-				col_size = 12;
+				col_size = MaxValue(SortConstants::STRING_PREFIX_BUDGET / prefixed_string_count,
+				                    SortConstants::MIN_STRING_PREFIX_SIZE);
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -450,6 +460,50 @@ void GlobalSortState::InitializeMergeRound() {
 	}
 }
 
+void GlobalSortState::InitializeKWayMerge() {
+	D_ASSERT(sorted_blocks_temp.empty());
+	idx_t total_count = 0;
+	for (auto &sb : sorted_blocks) {
+		total_count += sb->Count();
+	}
+	// Every partition but the last one gets exactly block_capacity rows
+	num_partitions = (total_count + block_capacity - 1) / block_capacity;
+	// The first partition starts at the beginning of each sorted block, the last one ends at its end
+	// The boundaries in between are computed in parallel
+	partition_bounds.assign(num_partitions + 1, vector<idx_t>(sorted_blocks.size(), 0));
+	for (idx_t block_idx = 0; block_idx < sorted_blocks.size(); block_idx++) {
+		partition_bounds.back()[block_idx] = sorted_blocks[block_idx]->Count();
+	}
+	splitter_idx = 1;
+}
+
+void GlobalSortState::PrepareKWayMergePartitions() {
+	partition_slices.clear();
+	partition_slice_starts.clear();
+	partition_slices.resize(num_partitions);
+	partition_slice_starts.resize(num_partitions);
+	for (idx_t p_idx = 0; p_idx < num_partitions; p_idx++) {
+		auto &starts = partition_bounds[p_idx];
+		auto &ends = partition_bounds[p_idx + 1];
+		for (idx_t block_idx = 0; block_idx < sorted_blocks.size(); block_idx++) {
+			D_ASSERT(starts[block_idx] <= ends[block_idx]);
+			if (starts[block_idx] == ends[block_idx]) {
+				continue;
+			}
+			idx_t entry_idx;
+			partition_slices[p_idx].push_back(
+			    sorted_blocks[block_idx]->CreateSlice(starts[block_idx], ends[block_idx], entry_idx));
+			partition_slice_starts[p_idx].push_back(entry_idx);
+		}
+	}
+	// The slices hold the remaining references to the data
+	sorted_blocks.clear();
+	partition_bounds.clear();
+	// Allocate room for the merge results, all partitions form a single sorted block
+	partition_idx = 0;
+	sorted_blocks_temp.emplace_back(num_partitions);
+}
+
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
 	for (auto &sorted_block_vector : sorted_blocks_temp) {
@@ -60,6 +60,18 @@ unique_ptr<SortedData> SortedData::CreateSlice(idx_t start_block_index, idx_t en
 	return result;
 }
 
+unique_ptr<SortedData> SortedData::CreateCopy(GlobalSortState &target) const {
+	auto result = make_uniq<SortedData>(type, layout, buffer_manager, target);
+	for (auto &data_block : data_blocks) {
+		result->data_blocks.push_back(data_block->Copy());
+	}
+	for (auto &heap_block : heap_blocks) {
+		result->heap_blocks.push_back(heap_block->Copy());
+	}
+	result->swizzled = swizzled;
+	return result;
+}
+
 void SortedData::Unswizzle() {
 	if (layout.AllConstant() || !swizzled) {
 		return;
@@ -184,6 +196,16 @@ unique_ptr<SortedBlock> SortedBlock::CreateSlice(const idx_t start, const idx_t
 	return result;
 }
 
+unique_ptr<SortedBlock> SortedBlock::CreateCopy(GlobalSortState &target) const {
+	auto result = make_uniq<SortedBlock>(buffer_manager, target);
+	for (auto &radix_block : radix_sorting_data) {
+		result->radix_sorting_data.push_back(radix_block->Copy());
+	}
+	result->blob_sorting_data = blob_sorting_data->CreateCopy(target);
+	result->payload_data = payload_data->CreateCopy(target);
+	return result;
+}
+
 idx_t SortedBlock::HeapSize() const {
 	idx_t result = 0;
 	if (!sort_layout.all_constant) {
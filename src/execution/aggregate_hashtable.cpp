@@ -55,6 +55,29 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 	// Predicates
 	predicates.resize(layout.ColumnCount() - 1, ExpressionType::COMPARE_NOT_DISTINCT_FROM);
 	row_matcher.Initialize(true, layout, predicates);
+
+	// Check whether the groups can be packed into (at most) two 64-bit words
+	idx_t group_width = 0;
+	for (idx_t col_idx = 0; col_idx < layout.ColumnCount() - 1; col_idx++) {
+		const auto internal_type = layout.GetTypes()[col_idx].InternalType();
+		if (!TypeIsIntegral(internal_type) && internal_type != PhysicalType::BOOL) {
+			group_width = DConstants::INVALID_INDEX;
+			break;
+		}
+		group_width += GetTypeIdSize(internal_type);
+	}
+	if (group_width == 0 || group_width > 2 * sizeof(uint64_t) || layout.ColumnCount() - 1 > 8) {
+		// Not integers, too wide, or the validity of the groups does not fit in the first validity byte
+		packed_group_words = 0;
+	} else {
+		// The rows always have the hash after the groups, so we can always load whole words
+		packed_group_words = (group_width + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+		data_t mask_bytes[2 * sizeof(uint64_t)];
+		memset(mask_bytes, 0, sizeof(mask_bytes));
+		memset(mask_bytes, 0xFF, group_width);
+		packed_group_masks[0] = Load<uint64_t>(mask_bytes);
+		packed_group_masks[1] = Load<uint64_t>(mask_bytes + sizeof(uint64_t));
+	}
 }
 
 void GroupedAggregateHashTable::InitializePartitionedData() {
@@ -246,6 +269,42 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 #endif
 
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::AddChunkPassthrough(DataChunk &groups, DataChunk &payload,
+                                                    const unsafe_vector<idx_t> &filter) {
+	if (groups.size() == 0) {
+		return;
+	}
+
+	Vector hashes(LogicalType::HASH);
+	groups.Hash(hashes);
+	InitializeGroupChunk(groups, hashes);
+
+	// Append all rows as new groups, without touching the pointer table
+	auto &chunk_state = state.append_state.chunk_state;
+	partitioned_data->AppendUnified(state.append_state, state.group_chunk, *FlatVector::IncrementalSelectionVector(),
+	                                groups.size());
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+	                                groups.size());
+
+	// The rows were appended in partition order, get the address of each input row
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	state.addresses.Flatten(groups.size());
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		addresses[i] = row_locations[row_sel.get_index(i)];
+	}
+
+	UpdateAggregates(payload, filter);
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	VectorOperations::AddInPlace(state.addresses, layout.GetAggrOffset(), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -275,9 +334,104 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		VectorOperations::AddInPlace(state.addresses, aggr.payload_size, payload.size());
 		filter_idx++;
 	}
+}
 
-	Verify();
-	return new_group_count;
+template <class T>
+static void PackGroupColumn(const UnifiedVectorFormat &format, const idx_t count, uint64_t *packed_groups,
+                            const idx_t packed_group_words, const idx_t byte_offset) {
+	const auto data = UnifiedVectorFormat::GetData<T>(format);
+	for (idx_t i = 0; i < count; i++) {
+		const auto packed_group = data_ptr_cast(packed_groups + i * packed_group_words);
+		Store<T>(data[format.sel->get_index(i)], packed_group + byte_offset);
+	}
+}
+
+bool GroupedAggregateHashTable::PackGroups(const idx_t count) {
+	const auto group_count = layout.ColumnCount() - 1;
+	for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+		if (!state.group_data[col_idx].validity.AllValid()) {
+			return false;
+		}
+	}
+
+	if (!state.packed_groups) {
+		state.packed_groups = make_unsafe_uniq_array<uint64_t>(STANDARD_VECTOR_SIZE * 2);
+	}
+	const auto packed_groups = state.packed_groups.get();
+	memset(packed_groups, 0, count * packed_group_words * sizeof(uint64_t));
+
+	const auto &offsets = layout.GetOffsets();
+	for (idx_t col_idx = 0; col_idx < group_count; col_idx++) {
+		const auto &format = state.group_data[col_idx];
+		const auto byte_offset = offsets[col_idx] - offsets[0];
+		switch (GetTypeIdSize(layout.GetTypes()[col_idx].InternalType())) {
+		case 1:
+			PackGroupColumn<uint8_t>(format, count, packed_groups, packed_group_words, byte_offset);
+			break;
+		case 2:
+			PackGroupColumn<uint16_t>(format, count, packed_groups, packed_group_words, byte_offset);
+			break;
+		case 4:
+			PackGroupColumn<uint32_t>(format, count, packed_groups, packed_group_words, byte_offset);
+			break;
+		case 8:
+			PackGroupColumn<uint64_t>(format, count, packed_groups, packed_group_words, byte_offset);
+			break;
+		case 16:
+			PackGroupColumn<uhugeint_t>(format, count, packed_groups, packed_group_words, byte_offset);
+			break;
+		default:
+			throw InternalException("Unsupported group width in GroupedAggregateHashTable::PackGroups");
+		}
+	}
+	return true;
+}
+
+template <idx_t PACKED_GROUP_WORDS>
+static void MatchPackedGroups(const uint64_t *packed_groups, const uint64_t *packed_group_masks,
+                              const idx_t group_offset, const uint8_t validity_mask, SelectionVector &sel,
+                              const idx_t count, Vector &row_locations, SelectionVector &no_match_sel,
+                              idx_t &no_match_count) {
+	const auto rows = FlatVector::GetData<data_ptr_t>(row_locations);
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto &row = rows[idx];
+
+		// The groups in the row must all be valid and equal to the packed groups
+		uint64_t difference = (Load<uint8_t>(row) & validity_mask) ^ validity_mask;
+		for (idx_t word_idx = 0; word_idx < PACKED_GROUP_WORDS; word_idx++) {
+			const auto word = Load<uint64_t>(row + group_offset + word_idx * sizeof(uint64_t));
+			difference |= (word ^ packed_groups[idx * PACKED_GROUP_WORDS + word_idx]) & packed_group_masks[word_idx];
+		}
+
+		if (difference == 0) {
+			sel.set_index(match_count++, idx);
+		} else {
+			no_match_sel.set_index(no_match_count++, idx);
+		}
+	}
+}
+
+void GroupedAggregateHashTable::InitializeGroupChunk(DataChunk &groups, Vector &group_hashes) {
+	// Make a chunk that references the groups and the hashes and convert to unified format
+	if (state.group_chunk.ColumnCount() == 0) {
+		state.group_chunk.InitializeEmpty(layout.GetTypes());
+	}
+	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes);
+	state.group_chunk.SetCardinality(groups);
+
+	// convert all vectors to unified format
+	auto &chunk_state = state.append_state.chunk_state;
+	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
+	if (!state.group_data) {
+		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
+	}
+	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -339,24 +493,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	// we start out with all entries [0, 1, 2, ..., groups.size()]
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
-	// Make a chunk that references the groups and the hashes and convert to unified format
-	if (state.group_chunk.ColumnCount() == 0) {
-		state.group_chunk.InitializeEmpty(layout.GetTypes());
-	}
-	D_ASSERT(state.group_chunk.ColumnCount() == layout.GetTypes().size());
-	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
-		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
-	}
-	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
-	state.group_chunk.SetCardinality(groups);
-
-	// convert all vectors to unified format
+	InitializeGroupChunk(groups, group_hashes_v);
 	auto &chunk_state = state.append_state.chunk_state;
-	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
-	if (!state.group_data) {
-		state.group_data = make_unsafe_uniq_array<UnifiedVectorFormat>(state.group_chunk.ColumnCount());
-	}
-	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
+	const auto packed = packed_group_words != 0 && PackGroups(groups.size());
+	const auto group_offset = layout.GetOffsets()[0];
+	const auto validity_mask = UnsafeNumericCast<uint8_t>((1U << groups.ColumnCount()) - 1);
 
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
@@ -425,8 +566,18 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 			}
 
 			// Perform group comparisons
-			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
-			                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			if (packed && packed_group_words == 1) {
+				MatchPackedGroups<1>(state.packed_groups.get(), packed_group_masks, group_offset, validity_mask,
+				                     state.group_compare_vector, need_compare_count, addresses_v,
+				                     state.no_match_vector, no_match_count);
+			} else if (packed) {
+				MatchPackedGroups<2>(state.packed_groups.get(), packed_group_masks, group_offset, validity_mask,
+				                     state.group_compare_vector, need_compare_count, addresses_v,
+				                     state.no_match_vector, no_match_count);
+			} else {
+				row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
+				                  need_compare_count, layout, addresses_v, &state.no_match_vector, no_match_count);
+			}
 		}
 
 		// Linear probing: each of the entries that do not match move to the next entry in the HT
@@ -11,24 +11,20 @@
 #include "duckdb/execution/index/art/node4.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
+#include "duckdb/execution/index/index_scan_range.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
-#include "duckdb/optimizer/matcher/expression_matcher.hpp"
 
 namespace duckdb {
 
 struct ARTIndexScanState : public IndexScanState {
 
-	//! Scan predicates (single predicate scan or range scan)
-	Value values[2];
-	//! Expressions of the scan predicates
-	ExpressionType expressions[2];
-	bool checked = false;
-	//! All scanned row IDs
-	vector<row_t> result_ids;
-	Iterator iterator;
+	//! Equality predicates on the leading columns of a compound key
+	vector<Value> prefix;
+	//! The sorted, non-overlapping ranges of the key column following the prefix
+	vector<IndexScanRange> ranges;
 };
 
 //===--------------------------------------------------------------------===//
@@ -97,115 +93,43 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Predicate Scans
 //===--------------------------------------------------------------------===//
 
-//! Initialize a single predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Transaction &transaction, const Value &value,
-                                                                const ExpressionType expression_type) {
-	// initialize point lookup
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filter_exprs) {
+	D_ASSERT(index_exprs.size() == types.size());
 	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
-
-//! Initialize a two predicate scan on the index with the given expression and column IDs
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction &transaction, const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	// initialize range lookup
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
-}
-
-unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-                                                  const Expression &filter_expr) {
-
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-	// try to find a matching index for any of the filter expressions
-
-	// create a matcher for a comparison with a constant
-	ComparisonExpressionMatcher matcher;
-	// match on a comparison type
-	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
-	// match on a constant comparison with the indexed expression
-	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(index_expr));
-	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
-
-	matcher.policy = SetMatcher::Policy::UNORDERED;
-
-	vector<reference<Expression>> bindings;
-	if (matcher.Match(const_cast<Expression &>(filter_expr), bindings)) { // NOLINT: Match does not alter the expr
-		// range or equality comparison with constant value
-		// we can use our index here
-		// bindings[0] = the expression
-		// bindings[1] = the index expression
-		// bindings[2] = the constant
-		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
-		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
-		auto comparison_type = comparison.type;
-		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
-			// the expression is on the right side, we flip them around
-			comparison_type = FlipComparisonExpression(comparison_type);
-		}
-		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
-			// equality value
-			// equality overrides any other bounds so we just break here
-			equal_value = constant_value;
-		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
-		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
-			// greater than means this is a lower bound
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
-			// smaller than means this is an upper bound
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
+	bool has_ranges = false;
+	for (idx_t column = 0; column < index_exprs.size(); column++) {
+		vector<IndexScanRange> ranges;
+		if (!IndexScanRange::ExtractRanges(*index_exprs[column], filter_exprs, ranges)) {
+			break;
 		}
-	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
-		// BETWEEN expression
-		auto &between = filter_expr.Cast<BoundBetweenExpression>();
-		if (!between.input->Equals(index_expr)) {
-			// expression doesn't match the index expression
-			return nullptr;
+		if (column + 1 < index_exprs.size() && ranges.size() == 1 && ranges[0].IsPoint()) {
+			// equality on a leading column of a compound key: continue with the next column
+			result->prefix.push_back(ranges[0].low);
+			continue;
 		}
-		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
-		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
-			// not a constant comparison
+		result->ranges = std::move(ranges);
+		has_ranges = true;
+		break;
+	}
+	if (!has_ranges) {
+		if (result->prefix.empty()) {
+			// none of the filters restrict the first key column
 			return nullptr;
 		}
-		low_value = (between.lower->Cast<BoundConstantExpression>()).value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
-	}
-
-	if (!equal_value.IsNull() || !low_value.IsNull() || !high_value.IsNull()) {
-		// we can scan this index using this predicate: try a scan
-		unique_ptr<IndexScanState> index_state;
-		if (!equal_value.IsNull()) {
-			// equality predicate
-			index_state = InitializeScanSinglePredicate(transaction, equal_value, ExpressionType::COMPARE_EQUAL);
-		} else if (!low_value.IsNull() && !high_value.IsNull()) {
-			// two-sided predicate
-			index_state = InitializeScanTwoPredicates(transaction, low_value, low_comparison_type, high_value,
-			                                          high_comparison_type);
-		} else if (!low_value.IsNull()) {
-			// less than predicate
-			index_state = InitializeScanSinglePredicate(transaction, low_value, low_comparison_type);
-		} else {
-			D_ASSERT(!high_value.IsNull());
-			index_state = InitializeScanSinglePredicate(transaction, high_value, high_comparison_type);
+		// scan all keys with the prefix
+		result->ranges.emplace_back();
+	}
+	if (index_exprs.size() > 1) {
+		// prefix scans compare against keys padded with 0xFF bytes, which only exceed all keys of strings
+		for (idx_t column = result->prefix.size(); column < logical_types.size(); column++) {
+			if (types[column] == PhysicalType::VARCHAR && logical_types[column].id() != LogicalTypeId::VARCHAR) {
+				return nullptr;
+			}
 		}
-		return index_state;
 	}
-	return nullptr;
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -451,18 +375,24 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 	// prepare the row_identifiers
 	row_identifiers.Flatten(count);
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	return ConstructFromSorted(count, keys, row_ids, 0);
+}
 
-	auto key_section = KeySection(0, count - 1, 0, 0);
+bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, row_t *row_ids, idx_t depth) {
+
+	auto key_section = KeySection(0, count - 1, depth, 0);
 	auto has_constraint = IsUnique();
 	if (!Construct(*this, keys, row_ids, tree, key_section, has_constraint)) {
 		return false;
 	}
 
 #ifdef DEBUG
-	D_ASSERT(!VerifyAndToStringInternal(true).empty());
+	if (depth == 0) {
+		D_ASSERT(!VerifyAndToStringInternal(true).empty());
+	}
 	for (idx_t i = 0; i < count; i++) {
 		D_ASSERT(!keys[i].Empty());
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = Lookup(tree, keys[i], depth);
 		D_ASSERT(Leaf::ContainsRowId(*this, *leaf, row_ids[i]));
 	}
 #endif
@@ -741,42 +671,6 @@ void ART::Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id)
 // Point Query (Equal)
 //===--------------------------------------------------------------------===//
 
-static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value) {
-	D_ASSERT(type == value.type().InternalType());
-	switch (type) {
-	case PhysicalType::BOOL:
-		return ARTKey::CreateARTKey<bool>(allocator, value.type(), value);
-	case PhysicalType::INT8:
-		return ARTKey::CreateARTKey<int8_t>(allocator, value.type(), value);
-	case PhysicalType::INT16:
-		return ARTKey::CreateARTKey<int16_t>(allocator, value.type(), value);
-	case PhysicalType::INT32:
-		return ARTKey::CreateARTKey<int32_t>(allocator, value.type(), value);
-	case PhysicalType::INT64:
-		return ARTKey::CreateARTKey<int64_t>(allocator, value.type(), value);
-	case PhysicalType::UINT8:
-		return ARTKey::CreateARTKey<uint8_t>(allocator, value.type(), value);
-	case PhysicalType::UINT16:
-		return ARTKey::CreateARTKey<uint16_t>(allocator, value.type(), value);
-	case PhysicalType::UINT32:
-		return ARTKey::CreateARTKey<uint32_t>(allocator, value.type(), value);
-	case PhysicalType::UINT64:
-		return ARTKey::CreateARTKey<uint64_t>(allocator, value.type(), value);
-	case PhysicalType::INT128:
-		return ARTKey::CreateARTKey<hugeint_t>(allocator, value.type(), value);
-	case PhysicalType::UINT128:
-		return ARTKey::CreateARTKey<uhugeint_t>(allocator, value.type(), value);
-	case PhysicalType::FLOAT:
-		return ARTKey::CreateARTKey<float>(allocator, value.type(), value);
-	case PhysicalType::DOUBLE:
-		return ARTKey::CreateARTKey<double>(allocator, value.type(), value);
-	case PhysicalType::VARCHAR:
-		return ARTKey::CreateARTKey<string_t>(allocator, value.type(), value);
-	default:
-		throw InternalException("Invalid type for the ART key");
-	}
-}
-
 bool ART::SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids) {
 
 	auto leaf = Lookup(tree, key, 0);
@@ -786,6 +680,30 @@ bool ART::SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids) {
 	return Leaf::GetRowIds(*this, *leaf, result_ids, max_count);
 }
 
+void ART::SearchEqualSorted(vector<ARTKey> &keys, const vector<sel_t> &positions, vector<row_t> &result_ids,
+                            vector<sel_t> &result_positions) {
+
+	IndexSharedLock shared_lock(*this);
+	idx_t key_start = 0;
+	for (idx_t i = 0; i < positions.size(); i++) {
+		auto position = positions[i];
+		auto match_start = result_ids.size();
+		if (i > 0 && keys[position] == keys[positions[i - 1]]) {
+			// duplicate key: repeat the row IDs of the previous key
+			for (idx_t match_idx = key_start; match_idx < match_start; match_idx++) {
+				result_ids.push_back(result_ids[match_idx]);
+			}
+		} else {
+			auto leaf = Lookup(tree, keys[position], 0);
+			if (leaf) {
+				Leaf::GetRowIds(*this, *leaf, result_ids, NumericLimits<idx_t>::Maximum());
+			}
+		}
+		key_start = match_start;
+		result_positions.resize(result_ids.size(), position);
+	}
+}
+
 void ART::SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size) {
 
 	// we need to look for a leaf
@@ -840,73 +758,55 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 }
 
 //===--------------------------------------------------------------------===//
-// Greater Than and Less Than
+// Range Query
 //===--------------------------------------------------------------------===//
 
-bool ART::SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	if (!tree.HasMetadata()) {
-		return true;
-	}
-	Iterator &it = state.iterator;
-
-	// find the lowest value that satisfies the predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, key, equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
-		}
-	}
-
-	// after that we continue the scan; we don't need to check the bounds as any value following this value is
-	// automatically bigger and hence satisfies our predicate
-	ARTKey empty_key = ARTKey();
-	return it.Scan(empty_key, max_count, result_ids, false);
-}
-
-bool ART::SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-                     vector<row_t> &result_ids) {
+bool ART::SearchRange(const ARTKey &lower_bound, bool left_equal, const ARTKey &upper_bound, bool right_equal,
+                      idx_t max_count, vector<row_t> &result_ids) {
 
 	if (!tree.HasMetadata()) {
 		return true;
 	}
-	Iterator &it = state.iterator;
-
-	if (!it.art) {
-		it.art = this;
-		// find the minimum value in the ART: we start scanning from this value
+	Iterator it;
+	it.art = this;
+	if (lower_bound.Empty()) {
+		// no lower bound: we start scanning from the minimum value in the ART
 		it.FindMinimum(tree);
-		// early-out, if the minimum value is higher than the upper bound
-		if (it.current_key > upper_bound) {
-			return true;
-		}
+	} else if (!it.LowerBound(tree, lower_bound, left_equal, 0)) {
+		// early-out, if the maximum value in the ART is lower than the lower bound
+		return true;
 	}
 
 	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, equal);
+	return it.Scan(upper_bound, max_count, result_ids, right_equal);
 }
 
-//===--------------------------------------------------------------------===//
-// Closed Range Query
-//===--------------------------------------------------------------------===//
-
-bool ART::SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-                           bool right_equal, idx_t max_count, vector<row_t> &result_ids) {
-
-	Iterator &it = state.iterator;
-
-	// find the first node that satisfies the left predicate
-	if (!it.art) {
-		it.art = this;
-		if (!it.LowerBound(tree, lower_bound, left_equal, 0)) {
-			// early-out, if the maximum value in the ART is lower than the lower bound
-			return true;
+ARTKey ART::CreateBoundKey(ArenaAllocator &allocator, const ARTKey &prefix_key, idx_t column, const Value &value,
+                           bool pad) {
+	ARTKey value_key;
+	if (!value.IsNull()) {
+		auto key_value = value;
+		value_key = ARTKey::CreateKey(allocator, types[column], key_value);
+	}
+	// the maximum key bytes of the remaining key columns: a string key compares less at its first byte already
+	uint32_t pad_len = 0;
+	for (idx_t i = value.IsNull() ? column : column + 1; pad && i < types.size(); i++) {
+		if (types[i] == PhysicalType::VARCHAR) {
+			pad_len++;
+			break;
 		}
+		pad_len += UnsafeNumericCast<uint32_t>(GetTypeIdSize(types[i]));
 	}
 
-	// now continue the scan until we reach the upper bound
-	return it.Scan(upper_bound, max_count, result_ids, right_equal);
+	ARTKey key(allocator, prefix_key.len + value_key.len + pad_len);
+	if (prefix_key.len > 0) {
+		memcpy(key.data, prefix_key.data, prefix_key.len);
+	}
+	if (value_key.len > 0) {
+		memcpy(key.data + prefix_key.len, value_key.data, value_key.len);
+	}
+	memset(key.data + prefix_key.len + value_key.len, 0xFF, pad_len);
+	return key;
 }
 
 bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
@@ -914,53 +814,45 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 
 	auto &scan_state = state.Cast<ARTIndexScanState>();
 	vector<row_t> row_ids;
-	bool success;
 
-	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
 	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
-
-	if (scan_state.values[1].IsNull()) {
-
-		// single predicate
-		lock_guard<mutex> l(lock);
-		switch (scan_state.expressions[0]) {
-		case ExpressionType::COMPARE_EQUAL:
-			success = SearchEqual(key, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			success = SearchGreater(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_GREATERTHAN:
-			success = SearchGreater(scan_state, key, false, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			success = SearchLess(scan_state, key, true, max_count, row_ids);
-			break;
-		case ExpressionType::COMPARE_LESSTHAN:
-			success = SearchLess(scan_state, key, false, max_count, row_ids);
-			break;
-		default:
-			throw InternalException("Index scan type not implemented");
+	ARTKey prefix_key;
+	for (idx_t i = 0; i < scan_state.prefix.size(); i++) {
+		D_ASSERT(scan_state.prefix[i].type().InternalType() == types[i]);
+		auto key = ARTKey::CreateKey(arena_allocator, types[i], scan_state.prefix[i]);
+		if (i == 0) {
+			prefix_key = key;
+		} else {
+			prefix_key.ConcatenateARTKey(arena_allocator, key);
 		}
-
-	} else {
-
-		// two predicates
-		lock_guard<mutex> l(lock);
-
-		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
-		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
-
-		bool left_equal = scan_state.expressions[0] == ExpressionType ::COMPARE_GREATERTHANOREQUALTO;
-		bool right_equal = scan_state.expressions[1] == ExpressionType ::COMPARE_LESSTHANOREQUALTO;
-		success = SearchCloseRange(scan_state, key, upper_bound, left_equal, right_equal, max_count, row_ids);
 	}
+	auto column = scan_state.prefix.size();
+	D_ASSERT(column < types.size());
 
-	if (!success) {
-		return false;
+	IndexSharedLock shared_lock(*this);
+	for (auto &range : scan_state.ranges) {
+		if (range.IsPoint() && column + 1 == types.size()) {
+			// point lookup of a full key
+			auto key = CreateBoundKey(arena_allocator, prefix_key, column, range.low, false);
+			if (!SearchEqual(key, max_count, row_ids)) {
+				return false;
+			}
+			continue;
+		}
+		// keys that continue past an exclusive lower bound or an inclusive upper bound must not match it
+		ARTKey lower_bound;
+		if (!range.low.IsNull() || !prefix_key.Empty()) {
+			lower_bound = CreateBoundKey(arena_allocator, prefix_key, column, range.low, !range.low_inclusive);
+		}
+		ARTKey upper_bound;
+		if (!range.high.IsNull() || !prefix_key.Empty()) {
+			upper_bound = CreateBoundKey(arena_allocator, prefix_key, column, range.high, range.high_inclusive);
+		}
+		if (!SearchRange(lower_bound, range.low_inclusive, upper_bound, range.high_inclusive, max_count, row_ids)) {
+			return false;
+		}
 	}
+
 	if (row_ids.empty()) {
 		return true;
 	}
@@ -1031,8 +923,8 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
 
-	// don't alter the index during constraint checking
-	lock_guard<mutex> l(lock);
+	// don't alter the index during constraint checking, but allow concurrent constraint checks
+	IndexSharedLock shared_lock(*this);
 
 	// first resolve the expressions for the index
 	DataChunk expression_chunk;
@@ -1216,6 +1108,12 @@ idx_t ART::GetInMemorySize(IndexLock &index_lock) {
 	return in_memory_size;
 }
 
+void ART::UnpinBuffers() {
+	for (auto &allocator : *allocators) {
+		allocator->UnpinBuffers();
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Merging
 //===--------------------------------------------------------------------===//
@@ -1230,6 +1128,51 @@ void ART::InitializeMerge(ARTFlags &flags) {
 	}
 }
 
+vector<ARTFlags> ART::InitializePartitionMerge(const vector<unique_ptr<ART>> &partitions) {
+
+	// the nodes of each partition are stored after the nodes of all preceding partitions
+	vector<ARTFlags> result(partitions.size());
+	vector<idx_t> buffer_counts(ALLOCATOR_COUNT, 0);
+	for (idx_t i = 0; i < partitions.size(); i++) {
+		D_ASSERT(partitions[i]->owns_data);
+		result[i].merge_buffer_counts = buffer_counts;
+		for (idx_t j = 0; j < ALLOCATOR_COUNT; j++) {
+			buffer_counts[j] += (*partitions[i]->allocators)[j]->GetUpperBoundBufferId();
+		}
+	}
+	return result;
+}
+
+void ART::PreparePartitionMerge(const ARTFlags &flags) {
+	if (tree.HasMetadata()) {
+		tree.InitializeMerge(*this, flags);
+	}
+}
+
+void ART::MergePartitions(vector<unique_ptr<ART>> &partitions, const vector<data_t> &key_bytes,
+                          const ARTKey &prefix_key, idx_t depth) {
+
+	D_ASSERT(!tree.HasMetadata());
+	D_ASSERT(partitions.size() == key_bytes.size());
+	D_ASSERT(partitions.size() > 1);
+
+	// merge the node storage, the buffer IDs of the partitions have already been incremented
+	for (auto &partition : partitions) {
+		for (idx_t i = 0; i < allocators->size(); i++) {
+			(*allocators)[i]->Merge(*(*partition->allocators)[i]);
+		}
+	}
+
+	// the subtrees of the partitions become the children of a new node after the common prefix of all keys
+	reference<Node> ref_node(tree);
+	Prefix::New(*this, ref_node, prefix_key, 0, UnsafeNumericCast<uint32_t>(depth));
+	Node::New(*this, ref_node, Node::GetARTNodeTypeByCount(partitions.size()));
+	for (idx_t i = 0; i < partitions.size(); i++) {
+		Node::InsertChild(*this, ref_node, key_bytes[i], partitions[i]->tree);
+		partitions[i]->tree = Node();
+	}
+}
+
 bool ART::MergeIndexes(IndexLock &state, Index &other_index) {
 
 	auto &other_art = other_index.Cast<ART>();
@@ -54,6 +54,42 @@ void ARTKey::CreateARTKey(ArenaAllocator &allocator, const LogicalType &type, AR
 	ARTKey::CreateARTKey(allocator, type, key, string_t(value, UnsafeNumericCast<uint32_t>(strlen(value))));
 }
 
+ARTKey ARTKey::CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value) {
+	D_ASSERT(type == value.type().InternalType());
+	switch (type) {
+	case PhysicalType::BOOL:
+		return ARTKey::CreateARTKey<bool>(allocator, value.type(), value);
+	case PhysicalType::INT8:
+		return ARTKey::CreateARTKey<int8_t>(allocator, value.type(), value);
+	case PhysicalType::INT16:
+		return ARTKey::CreateARTKey<int16_t>(allocator, value.type(), value);
+	case PhysicalType::INT32:
+		return ARTKey::CreateARTKey<int32_t>(allocator, value.type(), value);
+	case PhysicalType::INT64:
+		return ARTKey::CreateARTKey<int64_t>(allocator, value.type(), value);
+	case PhysicalType::UINT8:
+		return ARTKey::CreateARTKey<uint8_t>(allocator, value.type(), value);
+	case PhysicalType::UINT16:
+		return ARTKey::CreateARTKey<uint16_t>(allocator, value.type(), value);
+	case PhysicalType::UINT32:
+		return ARTKey::CreateARTKey<uint32_t>(allocator, value.type(), value);
+	case PhysicalType::UINT64:
+		return ARTKey::CreateARTKey<uint64_t>(allocator, value.type(), value);
+	case PhysicalType::INT128:
+		return ARTKey::CreateARTKey<hugeint_t>(allocator, value.type(), value);
+	case PhysicalType::UINT128:
+		return ARTKey::CreateARTKey<uhugeint_t>(allocator, value.type(), value);
+	case PhysicalType::FLOAT:
+		return ARTKey::CreateARTKey<float>(allocator, value.type(), value);
+	case PhysicalType::DOUBLE:
+		return ARTKey::CreateARTKey<double>(allocator, value.type(), value);
+	case PhysicalType::VARCHAR:
+		return ARTKey::CreateARTKey<string_t>(allocator, value.type(), value);
+	default:
+		throw InternalException("Invalid type for the ART key");
+	}
+}
+
 bool ARTKey::operator>(const ARTKey &k) const {
 	for (uint32_t i = 0; i < MinValue<uint32_t>(len, k.len); i++) {
 		if (data[i] > k.data[i]) {
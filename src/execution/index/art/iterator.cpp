@@ -108,13 +108,20 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 
 	// we found the lower bound
 	if (node.GetType() == NType::LEAF || node.GetType() == NType::LEAF_INLINED) {
-		if (!equal && current_key == key) {
+		if (!equal && depth == key.len && current_key == key) {
 			return Next();
 		}
 		last_leaf = node;
 		return true;
 	}
 
+	// the lower bound is a prefix of all keys in this subtree, e.g., if it only covers the leading columns of a
+	// compound key, so all of them are greater than the lower bound
+	if (depth >= key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(*art, next_byte);
@@ -145,6 +152,10 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	nodes.emplace(node, 0);
 
 	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		if (depth + i >= key.len) {
+			FindMinimum(prefix.ptr);
+			return true;
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
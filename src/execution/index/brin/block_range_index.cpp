@@ -0,0 +1,373 @@
+#include "duckdb/execution/index/brin/block_range_index.hpp"
+
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/index/index_scan_range.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+//! The summary of the keys of a range of row IDs
+struct BlockRangeSummary {
+	//! The smallest and the largest key of the range, as byte-comparable ART keys
+	data_t min_key[BlockRangeIndex::MAX_KEY_SIZE];
+	data_t max_key[BlockRangeIndex::MAX_KEY_SIZE];
+	//! Bit (hash % 64) is set for the hash of each key of the range, the bitmap of a range without keys is empty
+	uint64_t bitmap;
+	//! The summary of the next range
+	IndexPointer next;
+};
+
+struct BlockRangeIndexScanState : public IndexScanState {
+	//! The sorted, non-overlapping ranges of the key
+	vector<IndexScanRange> ranges;
+};
+
+//! The metadata of all pointers to summaries, which distinguishes them from empty pointers
+static constexpr uint8_t SUMMARY_METADATA = 1;
+
+static uint64_t GetKeyBit(const_data_ptr_t key, idx_t key_size) {
+	return uint64_t(1) << (Hash(const_char_ptr_cast(key), key_size) % 64);
+}
+
+//===--------------------------------------------------------------------===//
+// BRIN
+//===--------------------------------------------------------------------===//
+
+BlockRangeIndex::BlockRangeIndex(const string &name, const IndexConstraintType index_constraint_type,
+                                 const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                                 const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+                                 const case_insensitive_map_t<Value> &options, const IndexStorageInfo &info)
+    : Index(name, BlockRangeIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager,
+            unbound_expressions, db),
+      rows_per_range(DEFAULT_ROWS_PER_RANGE) {
+
+	if (index_constraint_type != IndexConstraintType::NONE) {
+		throw NotImplementedException("BRIN indexes do not support UNIQUE or PRIMARY KEY constraints");
+	}
+	if (types.size() != 1) {
+		throw NotImplementedException("BRIN indexes only support a single key column");
+	}
+	switch (types[0]) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		break;
+	default:
+		throw InvalidTypeException(logical_types[0], "Invalid type for BRIN index key.");
+	}
+	key_size = GetTypeIdSize(types[0]);
+	D_ASSERT(key_size <= MAX_KEY_SIZE);
+
+	for (auto &option : options) {
+		if (option.first != "rows_per_range") {
+			throw InvalidInputException("Unrecognized option \"%s\" for BRIN index", option.first);
+		}
+		auto value = option.second.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+		if (value <= 0) {
+			throw InvalidInputException("The option \"rows_per_range\" of BRIN indexes must be greater than 0");
+		}
+		rows_per_range = NumericCast<idx_t>(value);
+	}
+
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	allocator = make_uniq<FixedSizeAllocator>(sizeof(BlockRangeSummary), block_manager);
+
+	if (info.IsValid()) {
+		// the summaries are few, so we read the whole chain of summaries right away
+		D_ASSERT(!info.root_block_ptr.IsValid() && info.allocator_infos.size() == 1);
+		allocator->Init(info.allocator_infos[0]);
+		IndexPointer ptr;
+		ptr.Set(info.root);
+		while (ptr.HasMetadata()) {
+			summaries.push_back(ptr);
+			ptr = allocator->Get<const BlockRangeSummary>(ptr, false)->next;
+		}
+		allocator->UnpinBuffers();
+	}
+}
+
+BlockRangeSummary &BlockRangeIndex::GetOrCreateSummary(idx_t range_idx) {
+	while (summaries.size() <= range_idx) {
+		auto ptr = allocator->New();
+		ptr.SetMetadata(SUMMARY_METADATA);
+		auto summary = allocator->Get<BlockRangeSummary>(ptr);
+		summary->bitmap = 0;
+		summary->next.Clear();
+		if (!summaries.empty()) {
+			allocator->Get<BlockRangeSummary>(summaries.back())->next = ptr;
+		}
+		summaries.push_back(ptr);
+	}
+	return *allocator->Get<BlockRangeSummary>(summaries[range_idx]);
+}
+
+void BlockRangeIndex::AddKey(BlockRangeSummary &summary, const_data_ptr_t key) const {
+	if (summary.bitmap == 0) {
+		memcpy(summary.min_key, key, key_size);
+		memcpy(summary.max_key, key, key_size);
+	} else if (memcmp(key, summary.min_key, key_size) < 0) {
+		memcpy(summary.min_key, key, key_size);
+	} else if (memcmp(key, summary.max_key, key_size) > 0) {
+		memcpy(summary.max_key, key, key_size);
+	}
+	summary.bitmap |= GetKeyBit(key, key_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+
+unique_ptr<IndexScanState> BlockRangeIndex::TryInitializeScan(const Expression &index_expr,
+                                                              const vector<unique_ptr<Expression>> &filter_exprs) {
+	auto result = make_uniq<BlockRangeIndexScanState>();
+	if (!IndexScanRange::ExtractRanges(index_expr, filter_exprs, result->ranges)) {
+		return nullptr;
+	}
+	return std::move(result);
+}
+
+//! A range of keys, and the bit of its key in the bitmaps of the summaries if it is a point
+struct BlockRangeScanBounds {
+	ARTKey low;
+	ARTKey high;
+	bool low_inclusive;
+	bool high_inclusive;
+	uint64_t bit;
+};
+
+static bool SummaryMatches(const BlockRangeSummary &summary, const vector<BlockRangeScanBounds> &bounds,
+                           idx_t key_size) {
+	if (summary.bitmap == 0) {
+		return false;
+	}
+	for (auto &bound : bounds) {
+		if (!bound.low.Empty()) {
+			auto cmp = memcmp(summary.max_key, bound.low.data, key_size);
+			if (cmp < 0 || (cmp == 0 && !bound.low_inclusive)) {
+				continue;
+			}
+		}
+		if (!bound.high.Empty()) {
+			auto cmp = memcmp(summary.min_key, bound.high.data, key_size);
+			if (cmp > 0 || (cmp == 0 && !bound.high_inclusive)) {
+				continue;
+			}
+		}
+		if (bound.bit && !(summary.bitmap & bound.bit)) {
+			continue;
+		}
+		return true;
+	}
+	return false;
+}
+
+void BlockRangeIndex::Scan(DataTable &table, IndexScanState &state, vector<RowIdRange> &result_ranges) {
+
+	auto &scan_state = state.Cast<BlockRangeIndexScanState>();
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	vector<BlockRangeScanBounds> bounds;
+	for (auto &range : scan_state.ranges) {
+		BlockRangeScanBounds bound;
+		if (!range.low.IsNull()) {
+			auto low = range.low;
+			bound.low = ARTKey::CreateKey(arena_allocator, types[0], low);
+		}
+		if (!range.high.IsNull()) {
+			auto high = range.high;
+			bound.high = ARTKey::CreateKey(arena_allocator, types[0], high);
+		}
+		bound.low_inclusive = range.low_inclusive;
+		bound.high_inclusive = range.high_inclusive;
+		bound.bit = range.IsPoint() ? GetKeyBit(bound.low.data, key_size) : 0;
+		bounds.push_back(std::move(bound));
+	}
+
+	IndexSharedLock shared_lock(*this);
+	auto row_count = table.GetTotalRows();
+	for (idx_t range_idx = 0; range_idx < summaries.size(); range_idx++) {
+		auto summary = allocator->Get<const BlockRangeSummary>(summaries[range_idx], false);
+		if (!SummaryMatches(*summary, bounds, key_size)) {
+			continue;
+		}
+		// all rows of the range can contain matching keys
+		auto start = range_idx * rows_per_range;
+		auto end = MinValue<idx_t>(start + rows_per_range, row_count);
+		if (start >= end) {
+			break;
+		}
+		if (!result_ranges.empty() && result_ranges.back().end == start) {
+			result_ranges.back().end = end;
+		} else {
+			result_ranges.push_back({start, end});
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Insert / Verification / Constraint Checking
+//===--------------------------------------------------------------------===//
+
+ErrorData BlockRangeIndex::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
+
+	D_ASSERT(row_ids.GetType().InternalType() == ROW_TYPE);
+	D_ASSERT(logical_types[0] == input.data[0].GetType());
+
+	// generate the (byte-comparable) keys for the given input
+	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
+	vector<ARTKey> keys(input.size());
+	ART::GenerateKeys(arena_allocator, input, keys);
+
+	row_ids.Flatten(input.size());
+	auto row_identifiers = FlatVector::GetData<row_t>(row_ids);
+
+	// consecutive rows usually fall into the same range
+	auto current_range = DConstants::INVALID_INDEX;
+	optional_ptr<BlockRangeSummary> summary;
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (keys[i].Empty()) {
+			continue;
+		}
+		D_ASSERT(row_identifiers[i] >= 0 && row_identifiers[i] < MAX_ROW_ID);
+		auto range_idx = NumericCast<idx_t>(row_identifiers[i]) / rows_per_range;
+		if (range_idx != current_range) {
+			summary = &GetOrCreateSummary(range_idx);
+			current_range = range_idx;
+		}
+		AddKey(*summary, keys[i].data);
+	}
+	return ErrorData();
+}
+
+ErrorData BlockRangeIndex::Append(IndexLock &lock, DataChunk &appended_data, Vector &row_identifiers) {
+	DataChunk expression_result;
+	expression_result.Initialize(Allocator::DefaultAllocator(), logical_types);
+
+	// first resolve the expressions for the index
+	ExecuteExpressions(appended_data, expression_result);
+
+	// now insert into the index
+	return Insert(lock, expression_result, row_identifiers);
+}
+
+void BlockRangeIndex::VerifyAppend(DataChunk &chunk) {
+}
+
+void BlockRangeIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BlockRangeIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+string BlockRangeIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                      DataChunk &input) {
+	throw InternalException("BRIN indexes do not enforce constraints");
+}
+
+//===--------------------------------------------------------------------===//
+// Drop and Delete
+//===--------------------------------------------------------------------===//
+
+void BlockRangeIndex::CommitDrop(IndexLock &index_lock) {
+	allocator->Reset();
+	summaries.clear();
+}
+
+void BlockRangeIndex::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
+	// the summaries still cover the deleted keys, which only makes scans return more candidate rows
+}
+
+//===--------------------------------------------------------------------===//
+// Serialization
+//===--------------------------------------------------------------------===//
+
+IndexStorageInfo BlockRangeIndex::GetStorageInfo(const bool get_buffers) {
+
+	// the root is the summary of the first range
+	IndexStorageInfo info;
+	info.name = name;
+	info.root = summaries.empty() ? IndexPointer().Get() : summaries[0].Get();
+
+	if (!get_buffers) {
+		// store the data on disk as partial blocks and set the block ids
+		auto &block_manager = table_io_manager.GetIndexBlockManager();
+		PartialBlockManager partial_block_manager(block_manager, CheckpointType::FULL_CHECKPOINT);
+		allocator->SerializeBuffers(partial_block_manager);
+		partial_block_manager.FlushPartialBlocks();
+	} else {
+		// set the correct allocation sizes and get the map containing all buffers
+		info.buffers.push_back(allocator->InitSerializationToWAL());
+	}
+
+	info.allocator_infos.push_back(allocator->GetInfo());
+	return info;
+}
+
+//===--------------------------------------------------------------------===//
+// Merging / Vacuum / Size
+//===--------------------------------------------------------------------===//
+
+bool BlockRangeIndex::MergeIndexes(IndexLock &state, Index &other_index) {
+	auto &other = other_index.Cast<BlockRangeIndex>();
+	D_ASSERT(other.rows_per_range == rows_per_range && other.key_size == key_size);
+
+	// widen the summaries of this index by the summaries of the other index
+	for (idx_t range_idx = 0; range_idx < other.summaries.size(); range_idx++) {
+		auto &other_summary = *other.allocator->Get<const BlockRangeSummary>(other.summaries[range_idx], false);
+		if (other_summary.bitmap == 0) {
+			continue;
+		}
+		auto &summary = GetOrCreateSummary(range_idx);
+		AddKey(summary, other_summary.min_key);
+		AddKey(summary, other_summary.max_key);
+		summary.bitmap |= other_summary.bitmap;
+	}
+	return true;
+}
+
+void BlockRangeIndex::Vacuum(IndexLock &state) {
+}
+
+idx_t BlockRangeIndex::GetInMemorySize(IndexLock &index_lock) {
+	return allocator->GetInMemorySize();
+}
+
+void BlockRangeIndex::UnpinBuffers() {
+	allocator->UnpinBuffers();
+}
+
+//===--------------------------------------------------------------------===//
+// Utility
+//===--------------------------------------------------------------------===//
+
+string BlockRangeIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	idx_t non_empty_count = 0;
+	for (auto &ptr : summaries) {
+		auto summary = allocator->Get<const BlockRangeSummary>(ptr, false);
+		D_ASSERT(summary->bitmap == 0 || memcmp(summary->min_key, summary->max_key, key_size) <= 0);
+		non_empty_count += summary->bitmap != 0;
+	}
+	if (summaries.empty()) {
+		return "[empty]";
+	}
+	return StringUtil::Format("BRIN: %llu of %llu ranges of %llu rows contain keys", non_empty_count,
+	                          summaries.size(), rows_per_range);
+}
+
+constexpr const char *BlockRangeIndex::TYPE_NAME;
+
+} // namespace duckdb
@@ -53,6 +53,7 @@ IndexPointer FixedSizeAllocator::New() {
 		FixedSizeBuffer new_buffer(block_manager);
 		buffers.insert(make_pair(buffer_id, std::move(new_buffer)));
 		buffers_with_free_space.insert(buffer_id);
+		pinned_buffers.push_back(buffer_id);
 
 		// set the bitmask
 		D_ASSERT(buffers.find(buffer_id) != buffers.end());
@@ -75,6 +76,9 @@ IndexPointer FixedSizeAllocator::New() {
 
 	D_ASSERT(buffers.find(buffer_id) != buffers.end());
 	auto &buffer = buffers.find(buffer_id)->second;
+	if (!buffer.InMemory()) {
+		PinBuffer(buffer_id, buffer);
+	}
 	auto offset = buffer.GetOffset(bitmask_count);
 
 	total_segment_count++;
@@ -98,6 +102,9 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 
 	D_ASSERT(buffers.find(buffer_id) != buffers.end());
 	auto &buffer = buffers.find(buffer_id)->second;
+	if (!buffer.InMemory()) {
+		PinBuffer(buffer_id, buffer);
+	}
 
 	auto bitmask_ptr = reinterpret_cast<validity_t *>(buffer.Get());
 	ValidityMask mask(bitmask_ptr);
@@ -119,9 +126,29 @@ void FixedSizeAllocator::Reset() {
 	}
 	buffers.clear();
 	buffers_with_free_space.clear();
+	pinned_buffers.clear();
 	total_segment_count = 0;
 }
 
+void FixedSizeAllocator::UnpinBuffers() {
+	for (auto &buffer_id : pinned_buffers) {
+		auto buffer_it = buffers.find(buffer_id);
+		// changed buffers remain in memory until they are serialized
+		if (buffer_it != buffers.end() && buffer_it->second.OnDisk()) {
+			buffer_it->second.Unpin();
+		}
+	}
+	pinned_buffers.clear();
+}
+
+void FixedSizeAllocator::PinBuffer(const idx_t buffer_id, FixedSizeBuffer &buffer) {
+	lock_guard<mutex> guard(pin_lock);
+	if (!buffer.InMemory()) {
+		buffer.Pin();
+		pinned_buffers.push_back(buffer_id);
+	}
+}
+
 idx_t FixedSizeAllocator::GetInMemorySize() const {
 	idx_t memory_usage = 0;
 	for (auto &buffer : buffers) {
@@ -159,6 +186,12 @@ void FixedSizeAllocator::Merge(FixedSizeAllocator &other) {
 	}
 	other.buffers_with_free_space.clear();
 
+	// merge the pinned buffers
+	for (auto &buffer_id : other.pinned_buffers) {
+		pinned_buffers.push_back(buffer_id + upper_bound_id);
+	}
+	other.pinned_buffers.clear();
+
 	// add the total allocations
 	total_segment_count += other.total_segment_count;
 }
@@ -37,26 +37,36 @@ constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager)
     : block_manager(block_manager), segment_count(0), allocation_size(0), dirty(false), vacuum(false), block_pointer(),
-      block_handle(nullptr) {
+      block_handle(nullptr), in_memory(false) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(MemoryTag::ART_INDEX, Storage::BLOCK_SIZE, false, &block_handle);
+	in_memory.store(true, std::memory_order_release);
 }
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), segment_count(segment_count), allocation_size(allocation_size), dirty(false),
-      vacuum(false), block_pointer(block_pointer) {
+      vacuum(false), block_pointer(block_pointer), in_memory(false) {
 
 	D_ASSERT(block_pointer.IsValid());
-	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
+	block_handle = block_manager.RegisterBlock(block_pointer.block_id, MemoryTag::ART_INDEX);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 }
 
+FixedSizeBuffer::FixedSizeBuffer(FixedSizeBuffer &&other) noexcept
+    : block_manager(other.block_manager), segment_count(other.segment_count), allocation_size(other.allocation_size),
+      dirty(other.dirty), vacuum(other.vacuum), block_pointer(other.block_pointer),
+      buffer_handle(std::move(other.buffer_handle)), block_handle(std::move(other.block_handle)),
+      in_memory(other.in_memory.load()) {
+	other.in_memory = false;
+}
+
 void FixedSizeBuffer::Destroy() {
 	if (InMemory()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
 		// decrements the reader count on the underlying block handle (Destroy() unpins)
+		in_memory = false;
 		buffer_handle.Destroy();
 	}
 	if (OnDisk()) {
@@ -115,8 +125,9 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 	partial_block_manager.RegisterPartialBlock(std::move(allocation));
 
 	// resetting this buffer
+	in_memory = false;
 	buffer_handle.Destroy();
-	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
+	block_handle = block_manager.RegisterBlock(block_pointer.block_id, MemoryTag::ART_INDEX);
 	D_ASSERT(block_handle->BlockId() < MAXIMUM_BLOCK);
 
 	// we persist any changes, so the buffer is no longer dirty
@@ -125,11 +136,25 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 
 void FixedSizeBuffer::Pin() {
 	auto &buffer_manager = block_manager.buffer_manager;
-	D_ASSERT(block_pointer.IsValid());
-	D_ASSERT(block_handle && block_handle->BlockId() < MAXIMUM_BLOCK);
-	D_ASSERT(!dirty);
+	D_ASSERT(block_handle);
+	D_ASSERT(!OnDisk() || block_handle->BlockId() < MAXIMUM_BLOCK);
 
 	buffer_handle = buffer_manager.Pin(block_handle);
+	// publish the buffer handle to concurrent lookups
+	in_memory.store(true, std::memory_order_release);
+}
+
+void FixedSizeBuffer::Unpin() {
+	if (InMemory()) {
+		in_memory = false;
+		buffer_handle.Destroy();
+	}
+}
+
+void FixedSizeBuffer::CopyOnWrite() {
+	auto &buffer_manager = block_manager.buffer_manager;
+	D_ASSERT(InMemory() && OnDisk());
+	D_ASSERT(!dirty);
 
 	// we need to copy the (partial) data into a new (not yet disk-backed) buffer handle
 	shared_ptr<BlockHandle> new_block_handle;
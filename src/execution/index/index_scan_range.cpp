@@ -0,0 +1,229 @@
+#include "duckdb/execution/index/index_scan_range.hpp"
+
+#include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+
+namespace duckdb {
+
+bool IndexScanRange::IsPoint() const {
+	return !low.IsNull() && !high.IsNull() && low_inclusive && high_inclusive && low == high;
+}
+
+bool IndexScanRange::IsEmpty() const {
+	if (low.IsNull() || high.IsNull()) {
+		return false;
+	}
+	return low > high || (low == high && !(low_inclusive && high_inclusive));
+}
+
+//! Returns the tighter of two lower (or upper) bounds
+static void TightenBound(Value &bound, bool &inclusive, const Value &other, bool other_inclusive, bool lower) {
+	if (other.IsNull()) {
+		return;
+	}
+	if (bound.IsNull() || (lower ? other > bound : other < bound)) {
+		bound = other;
+		inclusive = other_inclusive;
+	} else if (other == bound) {
+		inclusive = inclusive && other_inclusive;
+	}
+}
+
+//! Intersects two sets of ranges
+static vector<IndexScanRange> IntersectRanges(const vector<IndexScanRange> &left, const vector<IndexScanRange> &right) {
+	vector<IndexScanRange> result;
+	for (auto &l : left) {
+		for (auto &r : right) {
+			auto range = l;
+			TightenBound(range.low, range.low_inclusive, r.low, r.low_inclusive, true);
+			TightenBound(range.high, range.high_inclusive, r.high, r.high_inclusive, false);
+			if (!range.IsEmpty()) {
+				result.push_back(std::move(range));
+			}
+		}
+	}
+	return result;
+}
+
+//! Sorts the ranges by their lower bound and merges overlapping ranges, so that each key is scanned at most once
+static void NormalizeRanges(vector<IndexScanRange> &ranges) {
+	std::sort(ranges.begin(), ranges.end(), [](const IndexScanRange &a, const IndexScanRange &b) {
+		if (a.low.IsNull() || b.low.IsNull()) {
+			return a.low.IsNull() && !b.low.IsNull();
+		}
+		return a.low < b.low || (a.low == b.low && a.low_inclusive && !b.low_inclusive);
+	});
+	vector<IndexScanRange> result;
+	for (auto &range : ranges) {
+		if (!result.empty()) {
+			auto &last = result.back();
+			auto overlaps = last.high.IsNull() || range.low.IsNull() || range.low < last.high ||
+			                (range.low == last.high && (range.low_inclusive || last.high_inclusive));
+			if (overlaps) {
+				if (range.high.IsNull() || (!last.high.IsNull() && range.high > last.high)) {
+					last.high = range.high;
+					last.high_inclusive = range.high_inclusive;
+				} else if (range.high == last.high) {
+					last.high_inclusive = last.high_inclusive || range.high_inclusive;
+				}
+				continue;
+			}
+		}
+		result.push_back(range);
+	}
+	ranges = std::move(result);
+}
+
+//! Returns whether the filter restricts the indexed expression to a set of ranges, and if so, the ranges
+static bool ExtractFilterRanges(const Expression &index_expr, const Expression &filter_expr,
+                                vector<IndexScanRange> &ranges) {
+	// create a matcher for a comparison with a constant
+	ComparisonExpressionMatcher matcher;
+	// match on a comparison type
+	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
+	// match on a constant comparison with the indexed expression
+	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(index_expr));
+	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
+
+	matcher.policy = SetMatcher::Policy::UNORDERED;
+
+	vector<reference<Expression>> bindings;
+	if (matcher.Match(const_cast<Expression &>(filter_expr), bindings)) { // NOLINT: Match does not alter the expr
+		// range or equality comparison with constant value
+		// bindings[0] = the expression
+		// bindings[1] = the index expression
+		// bindings[2] = the constant
+		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
+		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
+		if (constant_value.IsNull() || constant_value.type() != index_expr.return_type) {
+			return false;
+		}
+		auto comparison_type = comparison.type;
+		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
+			// the expression is on the right side, we flip them around
+			comparison_type = FlipComparisonExpression(comparison_type);
+		}
+		IndexScanRange range;
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			range.low = constant_value;
+			range.high = constant_value;
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHAN:
+			// greater than means this is a lower bound
+			range.low = constant_value;
+			range.low_inclusive = comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+			break;
+		default:
+			// smaller than means this is an upper bound
+			range.high = constant_value;
+			range.high_inclusive = comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+			break;
+		}
+		ranges.push_back(std::move(range));
+		return true;
+	}
+
+	switch (filter_expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = filter_expr.Cast<BoundBetweenExpression>();
+		if (!between.input->Equals(index_expr) || between.lower->type != ExpressionType::VALUE_CONSTANT ||
+		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
+			return false;
+		}
+		IndexScanRange range;
+		range.low = between.lower->Cast<BoundConstantExpression>().value;
+		range.low_inclusive = between.lower_inclusive;
+		range.high = between.upper->Cast<BoundConstantExpression>().value;
+		range.high_inclusive = between.upper_inclusive;
+		if (range.low.IsNull() || range.high.IsNull() || range.low.type() != index_expr.return_type ||
+		    range.high.type() != index_expr.return_type) {
+			return false;
+		}
+		if (!range.IsEmpty()) {
+			ranges.push_back(std::move(range));
+		}
+		return true;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		// IN list: one point lookup per (non-NULL) value
+		auto &op = filter_expr.Cast<BoundOperatorExpression>();
+		if (op.type != ExpressionType::COMPARE_IN || !op.children[0]->Equals(index_expr)) {
+			return false;
+		}
+		for (idx_t i = 1; i < op.children.size(); i++) {
+			if (op.children[i]->type != ExpressionType::VALUE_CONSTANT ||
+			    op.children[i]->return_type != index_expr.return_type) {
+				return false;
+			}
+		}
+		for (idx_t i = 1; i < op.children.size(); i++) {
+			auto &value = op.children[i]->Cast<BoundConstantExpression>().value;
+			if (!value.IsNull()) {
+				IndexScanRange range;
+				range.low = value;
+				range.high = value;
+				ranges.push_back(std::move(range));
+			}
+		}
+		return true;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = filter_expr.Cast<BoundConjunctionExpression>();
+		if (conjunction.type == ExpressionType::CONJUNCTION_OR) {
+			// the union of the ranges of all children, which must all restrict the indexed expression
+			vector<IndexScanRange> result;
+			for (auto &child : conjunction.children) {
+				if (!ExtractFilterRanges(index_expr, *child, result)) {
+					return false;
+				}
+			}
+			ranges.insert(ranges.end(), result.begin(), result.end());
+			return true;
+		}
+		// the intersection of the ranges of the children that restrict the indexed expression
+		vector<IndexScanRange> result(1);
+		bool restricted = false;
+		for (auto &child : conjunction.children) {
+			vector<IndexScanRange> child_ranges;
+			if (ExtractFilterRanges(index_expr, *child, child_ranges)) {
+				result = IntersectRanges(result, child_ranges);
+				restricted = true;
+			}
+		}
+		if (restricted) {
+			ranges.insert(ranges.end(), result.begin(), result.end());
+		}
+		return restricted;
+	}
+	default:
+		return false;
+	}
+}
+
+bool IndexScanRange::ExtractRanges(const Expression &index_expr, const vector<unique_ptr<Expression>> &filter_exprs,
+                                   vector<IndexScanRange> &ranges) {
+	// intersect the ranges of all filters on the indexed expression
+	vector<IndexScanRange> result(1);
+	bool restricted = false;
+	for (auto &filter : filter_exprs) {
+		vector<IndexScanRange> filter_ranges;
+		if (ExtractFilterRanges(index_expr, *filter, filter_ranges)) {
+			result = IntersectRanges(result, filter_ranges);
+			restricted = true;
+		}
+	}
+	if (!restricted) {
+		return false;
+	}
+	NormalizeRanges(result);
+	ranges = std::move(result);
+	return true;
+}
+
+} // namespace duckdb
@@ -23,7 +23,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), pointer_table_layout(JoinHashTableLayout::CHAINED),
+      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0), heavy_hitter_sample_offset(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -108,6 +109,12 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
 	}
 }
 
+static inline void PrefetchAddress(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#endif
+}
+
 void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
@@ -120,6 +127,8 @@ void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
 		result_data[rindex] = main_ht + (hash & bitmask);
+		// the buckets are loaded after all of them have been computed, so the cache misses of the batch overlap
+		PrefetchAddress(result_data[rindex]);
 	}
 }
 
@@ -239,6 +248,16 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 
+	// sample the hashes to detect heavy hitter keys, in case we have to repartition
+	UnifiedVectorFormat hdata;
+	hash_values.ToUnifiedFormat(keys.size(), hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	idx_t sample_idx;
+	for (sample_idx = heavy_hitter_sample_offset; sample_idx < added_count; sample_idx += HEAVY_HITTER_SAMPLE_RATE) {
+		heavy_hitters.Add(hash_data[hdata.sel->get_index(current_sel->get_index(sample_idx))]);
+	}
+	heavy_hitter_sample_offset = sample_idx - added_count;
+
 	// We already called TupleDataCollection::ToUnifiedFormat, so we can AppendUnified here
 	sink_collection->AppendUnified(append_state, source_chunk, *current_sel, added_count);
 }
@@ -288,9 +307,63 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 	}
 }
 
+static inline hash_t PointerToEntry(const data_ptr_t pointer) {
+	return static_cast<hash_t>(reinterpret_cast<uintptr_t>(pointer));
+}
+
+static inline data_ptr_t GetSaltedPointer(const hash_t entry) {
+	return reinterpret_cast<data_ptr_t>(static_cast<uintptr_t>(entry & JoinHashTable::POINTER_MASK));
+}
+
+template <bool PARALLEL>
+static inline void InsertSaltedHashesLoop(atomic<hash_t> entries[], const hash_t hashes[], const idx_t count,
+                                          const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                          const hash_t bitmask) {
+	for (idx_t i = 0; i < count; i++) {
+		const auto salt = hashes[i] & JoinHashTable::SALT_MASK;
+		const auto row_location = key_locations[i];
+		D_ASSERT((PointerToEntry(row_location) & JoinHashTable::SALT_MASK) == 0);
+		const auto new_entry = salt | PointerToEntry(row_location);
+
+		// linear probing: find the first slot that is either empty or holds the chain for this salt
+		auto index = hashes[i] & bitmask;
+		while (true) {
+			hash_t entry = entries[index];
+			if (entry != 0 && (entry & JoinHashTable::SALT_MASK) != salt) {
+				index = (index + 1) & bitmask;
+				continue;
+			}
+			// prepend the row to the chain of this slot (NOTE: the next pointer will be nullptr if the slot was empty)
+			Store<data_ptr_t>(GetSaltedPointer(entry), row_location + pointer_offset);
+			if (PARALLEL) {
+				if (!std::atomic_compare_exchange_weak(&entries[index], &entry, new_entry)) {
+					// another thread claimed or extended this slot in the meantime: inspect it again
+					continue;
+				}
+			} else {
+				entries[index] = new_entry;
+			}
+			break;
+		}
+	}
+}
+
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
 
+	if (pointer_table_layout == JoinHashTableLayout::LINEAR_PROBING) {
+		// we need the full hashes for the salts
+		hashes.Flatten(count);
+		auto entries = reinterpret_cast<atomic<hash_t> *>(hash_map.get());
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		if (parallel) {
+			InsertSaltedHashesLoop<true>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
+		} else {
+			InsertSaltedHashesLoop<false>(entries, hash_data, count, key_locations, pointer_offset, bitmask);
+		}
+		return;
+	}
+
 	// use bitmask to get position in array
 	ApplyBitmask(hashes, count);
 
@@ -377,20 +450,69 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		InitializePointers(*precomputed_hashes, current_sel, *ss);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		InitializePointers(hashes, current_sel, *ss);
+	}
+
+	return ss;
+}
+
+void JoinHashTable::InitializePointers(Vector &hashes, const SelectionVector *&current_sel, ScanStructure &ss) {
+	if (pointer_table_layout == JoinHashTableLayout::LINEAR_PROBING) {
+		FindSaltedChains(hashes, *current_sel, ss);
+		return;
 	}
+	ApplyBitmask(hashes, *current_sel, ss.count, ss.pointers);
 
 	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
+	ss.InitializeSelectionVector(current_sel);
+}
 
-	return ss;
+void JoinHashTable::FindSaltedChains(Vector &hashes, const SelectionVector &sel, ScanStructure &ss) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(ss.count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	// first compute the initial slot of every key, and prefetch them all before any of them is loaded
+	auto entries = reinterpret_cast<hash_t *>(hash_map.get());
+	auto ptrs = FlatVector::GetData<data_ptr_t>(ss.pointers);
+	for (idx_t i = 0; i < ss.count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto hash = hash_data[hdata.sel->get_index(idx)];
+		auto slot = entries + (hash & bitmask);
+		ptrs[idx] = data_ptr_cast(slot);
+		PrefetchAddress(slot);
+	}
+
+	// now walk the slots: a key only continues with its chain if the salt of a slot matches
+	idx_t found_count = 0;
+	for (idx_t i = 0; i < ss.count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto salt = hash_data[hdata.sel->get_index(idx)] & SALT_MASK;
+		auto index = NumericCast<hash_t>(reinterpret_cast<hash_t *>(ptrs[idx]) - entries);
+		while (true) {
+			const auto entry = entries[index];
+			if (entry == 0) {
+				// empty slot: no row with this hash
+				break;
+			}
+			if ((entry & SALT_MASK) == salt) {
+				ptrs[idx] = GetSaltedPointer(entry);
+				// the keys of the chains are compared after all chains have been found
+				PrefetchAddress(ptrs[idx]);
+				ss.sel_vector.set_index(found_count++, idx);
+				break;
+			}
+			index = (index + 1) & bitmask;
+		}
+	}
+	ss.count = found_count;
 }
 
 ScanStructure::ScanStructure(JoinHashTable &ht_p, TupleDataChunkState &key_state_p)
@@ -1013,27 +1135,119 @@ void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
-void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
+void JoinHashTable::HeavyHitterSketch::Add(hash_t hash, idx_t count) {
+	sample_count += count;
+	idx_t min_idx = 0;
+	for (idx_t counter_idx = 0; counter_idx < counters.size(); counter_idx++) {
+		auto &counter = counters[counter_idx];
+		if (counter.first == hash) {
+			counter.second += count;
+			return;
+		}
+		if (counter.second < counters[min_idx].second) {
+			min_idx = counter_idx;
+		}
+	}
+	if (counters.size() < CAPACITY) {
+		counters.emplace_back(hash, count);
+		return;
+	}
+	// the sketch is full: the new hash inherits the count of the least frequent hash, which it replaces
+	counters[min_idx].first = hash;
+	counters[min_idx].second += count;
+}
+
+void JoinHashTable::HeavyHitterSketch::Combine(const HeavyHitterSketch &other) {
+	// the counters of the other sketch may not cover all of its samples
+	const auto combined_sample_count = sample_count + other.sample_count;
+	for (auto &counter : other.counters) {
+		Add(counter.first, counter.second);
+	}
+	sample_count = combined_sample_count;
+}
+
+//! Estimates the size of the largest partition HT after adding bits to the radix partitioning. The rows of a heavy
+//! hitter key all end up in the same partition, so only the remaining rows are divided over the new partitions
+static double EstimateMaxPartitionHTSize(const vector<idx_t> &partition_sizes, const vector<idx_t> &partition_counts,
+                                         const vector<idx_t> &heavy_hitter_counts,
+                                         const vector<idx_t> &largest_heavy_hitter_counts, const idx_t added_bits) {
+	const double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+	double result = 0;
+	for (idx_t partition_idx = 0; partition_idx < partition_counts.size(); partition_idx++) {
+		const auto partition_count = partition_counts[partition_idx];
+		if (partition_count == 0) {
+			continue;
+		}
+		const auto row_size = double(partition_sizes[partition_idx]) / double(partition_count);
+		const auto heavy_hitter_count = MinValue<idx_t>(heavy_hitter_counts[partition_idx], partition_count);
+		const auto new_estimated_count = double(largest_heavy_hitter_counts[partition_idx]) +
+		                                 double(partition_count - heavy_hitter_count) / partition_multiplier;
+		const auto new_estimated_ht_size =
+		    new_estimated_count * row_size + double(JoinHashTable::PointerTableSize(idx_t(new_estimated_count)));
+		result = MaxValue<double>(result, new_estimated_ht_size);
+	}
+	return result;
+}
+
+bool JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
                                             const idx_t max_partition_size, const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
 
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
-	idx_t added_bits = 1;
-	for (; added_bits < max_added_bits; added_bits++) {
-		double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
+	if (max_added_bits == 0) {
+		return false;
+	}
 
-		auto new_estimated_size = double(max_partition_size) / partition_multiplier;
-		auto new_estimated_count = double(max_partition_count) / partition_multiplier;
-		auto new_estimated_ht_size = new_estimated_size + PointerTableSize(new_estimated_count);
+	// Gather the partition sizes and find out how many rows of each partition belong to heavy hitter keys
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	vector<idx_t> partition_sizes(num_partitions, 0);
+	vector<idx_t> partition_counts(num_partitions, 0);
+	HeavyHitterSketch sketch;
+	for (auto &ht : local_hts) {
+		ht->GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
+		sketch.Combine(ht->heavy_hitters);
+	}
+	vector<idx_t> heavy_hitter_counts(num_partitions, 0);
+	vector<idx_t> largest_heavy_hitter_counts(num_partitions, 0);
+	for (idx_t counter_idx = 0; counter_idx < sketch.counters.size(); counter_idx++) {
+		if (!sketch.IsHeavyHitter(counter_idx)) {
+			continue;
+		}
+		const auto hash = sketch.counters[counter_idx].first;
+		const auto partition_idx = (hash & RadixPartitioning::Mask(radix_bits)) >> RadixPartitioning::Shift(radix_bits);
+		const auto estimated_count =
+		    MinValue<idx_t>(sketch.EstimatedCount(counter_idx), partition_counts[partition_idx]);
+		heavy_hitter_counts[partition_idx] += estimated_count;
+		largest_heavy_hitter_counts[partition_idx] =
+		    MaxValue<idx_t>(largest_heavy_hitter_counts[partition_idx], estimated_count);
+	}
+
+	// If the largest partition is dominated by a heavy hitter, a repartitioning pass is wasted: it cannot be split
+	const double max_partition_ht_size = double(max_partition_size + PointerTableSize(max_partition_count));
+	if (EstimateMaxPartitionHTSize(partition_sizes, partition_counts, heavy_hitter_counts, largest_heavy_hitter_counts,
+	                               1) > max_partition_ht_size * 0.75) {
+		return false;
+	}
 
+	idx_t added_bits = 1;
+	for (; added_bits < max_added_bits; added_bits++) {
+		auto new_estimated_ht_size = EstimateMaxPartitionHTSize(partition_sizes, partition_counts, heavy_hitter_counts,
+		                                                        largest_heavy_hitter_counts, added_bits);
 		if (new_estimated_ht_size <= double(max_ht_size) / 4) {
 			// Aim for an estimated partition size of max_ht_size / 4
 			break;
 		}
+		auto next_estimated_ht_size = EstimateMaxPartitionHTSize(
+		    partition_sizes, partition_counts, heavy_hitter_counts, largest_heavy_hitter_counts, added_bits + 1);
+		if (next_estimated_ht_size > new_estimated_ht_size * 0.75) {
+			// The heavy hitters dominate the largest partition, more partitions will not make it much smaller
+			break;
+		}
 	}
 	radix_bits += added_bits;
 	sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	return true;
 }
 
 void JoinHashTable::Repartition(JoinHashTable &global_ht) {
@@ -1138,10 +1352,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
-
-	// create the selection vector linking to only non-empty entries
-	ss->InitializeSelectionVector(current_sel);
+	InitializePointers(hashes, current_sel, *ss);
 
 	return ss;
 }
@@ -0,0 +1,311 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(!groups.empty());
+	D_ASSERT(CanStreamAggregates(aggregates));
+}
+
+bool PhysicalStreamingAggregate::CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expr : aggregates) {
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			// distinct aggregates need a hash table per group
+			return false;
+		}
+		if (!aggregate.function.combine) {
+			// the states of a group that continues in the next chunk are combined into a new arena
+			return false;
+		}
+		// the children of the aggregates must be extracted into consecutive columns of the input, as must the filters
+		for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+			auto &child = aggregate.children[child_idx];
+			if (child->type != ExpressionType::BOUND_REF) {
+				return false;
+			}
+			auto &first_child = aggregate.children[0]->Cast<BoundReferenceExpression>();
+			if (child->Cast<BoundReferenceExpression>().index != first_child.index + child_idx) {
+				return false;
+			}
+		}
+		if (aggregate.filter && aggregate.filter->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+	}
+	return true;
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op)
+	    : allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context))),
+	      next_allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context))), has_group(false),
+	      addresses(LogicalType::POINTER), state_addresses(LogicalType::POINTER), group_starts(STANDARD_VECTOR_SIZE),
+	      previous_rows(STANDARD_VECTOR_SIZE), distinct_rows(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> group_types;
+		for (auto &group : op.groups) {
+			group_types.push_back(group->return_type);
+		}
+		last_group.Initialize(Allocator::Get(context), group_types, 1);
+
+		vector<BoundAggregateExpression *> bindings;
+		for (auto &aggregate : op.aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			bindings.push_back(&aggr);
+			filter_executors.push_back(aggr.filter ? make_uniq<ExpressionExecutor>(context, *aggr.filter) : nullptr);
+		}
+		layout.Initialize(AggregateObject::CreateAggregateObjects(bindings));
+
+		// A chunk can finish the current group and start a new group for every row
+		states = make_unsafe_uniq_array<data_t>((STANDARD_VECTOR_SIZE + 1) * layout.GetRowWidth());
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			previous_rows.set_index(i, i == 0 ? 0 : i - 1);
+		}
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			DestroyStates(0, 1);
+		}
+	}
+
+	//! Returns the aggregate states of a group
+	data_ptr_t GetStates(idx_t group_idx) {
+		return states.get() + group_idx * layout.GetRowWidth();
+	}
+
+	//! Sets the addresses to the aggregate states of consecutive groups
+	void SetStateAddresses(idx_t group_idx, idx_t count) {
+		auto data = FlatVector::GetData<data_ptr_t>(state_addresses);
+		for (idx_t i = 0; i < count; i++) {
+			data[i] = GetStates(group_idx + i);
+		}
+	}
+
+	void InitializeStates(idx_t group_idx, idx_t count) {
+		SetStateAddresses(group_idx, count);
+		RowOperations::InitializeStates(layout, state_addresses, *FlatVector::IncrementalSelectionVector(), count);
+	}
+
+	void DestroyStates(idx_t group_idx, idx_t count) {
+		if (!layout.HasDestructor()) {
+			return;
+		}
+		SetStateAddresses(group_idx, count);
+		RowOperationsState row_state(*allocator);
+		RowOperations::DestroyStates(row_state, layout, state_addresses, count);
+	}
+
+	//! Moves the aggregate states of a group to another group, and into the other arena. The states of all other
+	//! groups must have been destroyed, as their arena is reset
+	void MoveStates(idx_t source_idx, idx_t target_idx) {
+		InitializeStates(target_idx, 1);
+		Vector sources(LogicalType::POINTER);
+		Vector targets(LogicalType::POINTER);
+		auto &aggregates = layout.GetAggregates();
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			const auto offset = layout.GetOffsets()[aggr_idx];
+			FlatVector::GetData<data_ptr_t>(sources)[0] = GetStates(source_idx) + offset;
+			FlatVector::GetData<data_ptr_t>(targets)[0] = GetStates(target_idx) + offset;
+			// the source arena is reset afterwards, so the target must not take over any of the source's memory
+			AggregateInputData aggr_input_data(aggr.GetFunctionData(), *next_allocator,
+			                                   AggregateCombineType::PRESERVE_INPUT);
+			aggr.function.combine(sources, targets, aggr_input_data, 1);
+		}
+		DestroyStates(source_idx, 1);
+		allocator->Reset();
+		std::swap(allocator, next_allocator);
+	}
+
+	//! Arena allocator for the aggregate states, and the arena that the states of the current group move to when
+	//! groups finish
+	unique_ptr<ArenaAllocator> allocator;
+	unique_ptr<ArenaAllocator> next_allocator;
+	//! The layout of the aggregate states of a group
+	TupleDataLayout layout;
+	//! The aggregate states of the groups of the current chunk, the current group is always the first
+	unsafe_unique_array<data_t> states;
+	//! Whether there is a current group, i.e., whether any rows have been seen
+	bool has_group;
+	//! The groups of the current group
+	DataChunk last_group;
+	//! The executors of the aggregate filters
+	vector<unique_ptr<ExpressionExecutor>> filter_executors;
+
+	//! The addresses of the aggregate states of the rows of the input
+	Vector addresses;
+	//! The addresses of the aggregate states of groups
+	Vector state_addresses;
+	//! The rows of the input at which new groups start
+	SelectionVector group_starts;
+	//! For each row of the input, the previous row
+	SelectionVector previous_rows;
+	//! The rows of the input whose groups differ from those of the previous row
+	SelectionVector distinct_rows;
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// Find the rows whose groups differ from those of the previous row
+	bool new_group[STANDARD_VECTOR_SIZE];
+	memset(new_group, 0, count * sizeof(bool));
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		Vector previous(column, state.previous_rows, count);
+		const auto distinct_count =
+		    VectorOperations::DistinctFrom(column, previous, nullptr, count, &state.distinct_rows, nullptr);
+		for (idx_t i = 0; i < distinct_count; i++) {
+			new_group[state.distinct_rows.get_index(i)] = true;
+		}
+		if (state.has_group && !new_group[0]) {
+			// The first row is compared with the current group
+			Vector first(column, *FlatVector::IncrementalSelectionVector(), 1);
+			new_group[0] = VectorOperations::DistinctFrom(first, state.last_group.data[group_idx], nullptr, 1,
+			                                              &state.distinct_rows, nullptr) != 0;
+		}
+	}
+	if (!state.has_group) {
+		new_group[0] = true;
+	}
+
+	// Assign the rows to groups, the current group (if any) is the first group
+	idx_t group_count = state.has_group ? 1 : 0;
+	const auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < count; i++) {
+		if (new_group[i]) {
+			state.group_starts.set_index(group_count++, i);
+		}
+		addresses[i] = state.GetStates(group_count - 1);
+	}
+	const idx_t first_new_group = state.has_group ? 1 : 0;
+	state.InitializeStates(first_new_group, group_count - first_new_group);
+
+	// Update the aggregate states
+	RowOperationsState row_state(*state.allocator);
+	auto &aggregate_objects = state.layout.GetAggregates();
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggregate = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto &aggr = aggregate_objects[aggr_idx];
+		const auto arg_idx =
+		    aggregate.children.empty() ? 0 : aggregate.children[0]->Cast<BoundReferenceExpression>().index;
+
+		// Point to the state of this aggregate
+		Vector aggr_addresses(LogicalType::POINTER);
+		VectorOperations::Copy(state.addresses, aggr_addresses, count, 0, 0);
+		VectorOperations::AddInPlace(aggr_addresses, NumericCast<int64_t>(state.layout.GetOffsets()[aggr_idx]), count);
+		if (aggregate.filter) {
+			SelectionVector true_sel(STANDARD_VECTOR_SIZE);
+			const auto filtered_count = state.filter_executors[aggr_idx]->SelectExpression(input, true_sel);
+			if (filtered_count == 0) {
+				continue;
+			}
+			DataChunk filtered_input;
+			filtered_input.InitializeEmpty(input.GetTypes());
+			filtered_input.Slice(input, true_sel, filtered_count);
+			Vector filtered_addresses(aggr_addresses, true_sel, filtered_count);
+			filtered_addresses.Flatten(filtered_count);
+			RowOperations::UpdateStates(row_state, aggr, filtered_addresses, filtered_input, arg_idx, filtered_count);
+		} else {
+			RowOperations::UpdateStates(row_state, aggr, aggr_addresses, input, arg_idx, count);
+		}
+	}
+
+	// Emit all groups but the last one, which can continue in the next chunk
+	const auto finished_count = group_count - 1;
+	chunk.SetCardinality(finished_count);
+	if (finished_count != 0) {
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+			auto &result = chunk.data[group_idx];
+			if (first_new_group == 1) {
+				VectorOperations::Copy(state.last_group.data[group_idx], result, 1, 0, 0);
+			}
+			VectorOperations::Copy(column, result, state.group_starts, finished_count, first_new_group,
+			                       first_new_group);
+		}
+		state.SetStateAddresses(0, finished_count);
+		RowOperations::FinalizeStates(row_state, state.layout, state.state_addresses, chunk, groups.size());
+		state.DestroyStates(0, finished_count);
+
+		// Move the states of the last group to the front, so that the memory of the finished groups is released
+		state.MoveStates(finished_count, 0);
+	}
+
+	// Remember the groups of the last group
+	state.last_group.Reset();
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+		VectorOperations::Copy(column, state.last_group.data[group_idx], count, count - 1, 0);
+	}
+	state.last_group.SetCardinality(1);
+	state.has_group = true;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+
+	// Emit the last group
+	chunk.SetCardinality(1);
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		chunk.data[group_idx].Reference(state.last_group.data[group_idx]);
+	}
+	state.SetStateAddresses(0, 1);
+	RowOperationsState row_state(*state.allocator);
+	RowOperations::FinalizeStates(row_state, state.layout, state.state_addresses, chunk, groups.size());
+	state.DestroyStates(0, 1);
+	state.has_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		result += "\n";
+		result += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -89,4 +89,15 @@ string PhysicalFilter::ParamsToString() const {
 	return result;
 }
 
+bool PhysicalFilter::Equals(const PhysicalOperator &other_p) const {
+	if (type != other_p.type) {
+		return false;
+	}
+	auto &other = other_p.Cast<PhysicalFilter>();
+	if (expression->IsVolatile()) {
+		return false;
+	}
+	return expression->Equals(*other.expression);
+}
+
 } // namespace duckdb
@@ -0,0 +1,148 @@
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
+
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+JoinFilterPushdownInfo::JoinFilterPushdownInfo(shared_ptr<DynamicTableFilterSet> dynamic_filters_p,
+                                               idx_t bloom_filter_bit_count_p)
+    : dynamic_filters(std::move(dynamic_filters_p)), bloom_filter_bit_count(bloom_filter_bit_count_p) {
+}
+
+void JoinFilterPushdownInfo::InitializeState(const PhysicalHashJoin &op, JoinFilterState &state) const {
+	for (auto &filter : filters) {
+		unique_ptr<BaseStatistics> min_max;
+		if (filter.min_max) {
+			min_max = NumericStats::CreateEmpty(op.condition_types[filter.join_condition]).ToUnique();
+		}
+		state.min_max.push_back(std::move(min_max));
+
+		unique_ptr<BloomFilter> bloom_filter;
+		if (filter.bloom_filter) {
+			bloom_filter = make_uniq<BloomFilter>(bloom_filter_bit_count);
+		}
+		state.bloom_filters.push_back(std::move(bloom_filter));
+	}
+}
+
+unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(const PhysicalHashJoin &op) const {
+	// filters of a previous execution of the join (e.g., of a prepared statement) are no longer valid
+	dynamic_filters->ClearFilters(op);
+	auto result = make_uniq<JoinFilterGlobalState>();
+	InitializeState(op, *result);
+	return result;
+}
+
+unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(const PhysicalHashJoin &op) const {
+	auto result = make_uniq<JoinFilterLocalState>();
+	InitializeState(op, *result);
+	return result;
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat vdata;
+	keys.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		NumericStats::Update<T>(stats, data[idx]);
+	}
+}
+
+static void UpdateMinMax(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateMinMax<int8_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateMinMax<int16_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateMinMax<int32_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateMinMax<int64_t>(stats, keys, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateMinMax<hugeint_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateMinMax<uint8_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateMinMax<uint16_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateMinMax<uint32_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateMinMax<uint64_t>(stats, keys, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateMinMax<uhugeint_t>(stats, keys, count);
+		break;
+	default:
+		throw InternalException("Unsupported type for join filter min/max");
+	}
+}
+
+void JoinFilterPushdownInfo::Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const {
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		auto &keys = join_keys.data[filters[filter_idx].join_condition];
+		if (lstate.min_max[filter_idx]) {
+			UpdateMinMax(*lstate.min_max[filter_idx], keys, join_keys.size());
+		}
+		if (lstate.bloom_filters[filter_idx]) {
+			lstate.bloom_filters[filter_idx]->Insert(keys, join_keys.size());
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
+	lock_guard<mutex> guard(gstate.lock);
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		if (gstate.min_max[filter_idx]) {
+			gstate.min_max[filter_idx]->Merge(*lstate.min_max[filter_idx]);
+		}
+		if (gstate.bloom_filters[filter_idx]) {
+			gstate.bloom_filters[filter_idx]->Merge(*lstate.bloom_filters[filter_idx]);
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(const PhysicalHashJoin &op, JoinFilterGlobalState &gstate,
+                                         idx_t build_count) const {
+	if (build_count == 0) {
+		// the join has no output on the probe side: the filters would not be used anyway
+		return;
+	}
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		auto &filter = filters[filter_idx];
+		if (gstate.min_max[filter_idx]) {
+			auto &stats = *gstate.min_max[filter_idx];
+			auto min = NumericStats::Min(stats);
+			auto max = NumericStats::Max(stats);
+			if (min <= max) {
+				dynamic_filters->PushFilter(
+				    op, filter.probe_column_index,
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min)));
+				dynamic_filters->PushFilter(
+				    op, filter.probe_column_index,
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max)));
+			}
+		}
+		auto &bloom_filter = gstate.bloom_filters[filter_idx];
+		if (bloom_filter && bloom_filter->CanHold(build_count)) {
+			// only push the bloom filter if the build side was not (much) larger than estimated
+			dynamic_filters->PushFilter(op, filter.probe_column_index, std::move(bloom_filter));
+		}
+	}
+}
+
+} // namespace duckdb
@@ -17,22 +17,33 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 	return perfect_join_statistics.is_build_small;
 }
 
+bool PerfectHashJoinExecutor::SupportsJoinType(JoinType join_type) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+	case JoinType::MARK:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool PerfectHashJoinExecutor::HasBuildPayload() const {
+	return join.join_type == JoinType::INNER;
+}
+
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
 bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
-	// First, allocate memory for each build column
+	// allocate the bitmap that marks which keys occur in the build side
 	auto build_size = perfect_join_statistics.build_range + 1;
-	for (const auto &type : join.rhs_output_types) {
-		perfect_hash_table.emplace_back(type, build_size);
-	}
-
-	// and for duplicate_checking
-	bitmap_build_idx = make_unsafe_uniq_array<bool>(build_size);
-	memset(bitmap_build_idx.get(), 0, sizeof(bool) * build_size); // set false
-
-	// Now fill columns with build data
+	auto bitmap_entries = (build_size + BITS_PER_ENTRY - 1) / BITS_PER_ENTRY;
+	bitmap_build_idx = make_unsafe_uniq_array<idx_t>(bitmap_entries);
+	memset(bitmap_build_idx.get(), 0, sizeof(idx_t) * bitmap_entries);
 
+	// Now fill the bitmap and the columns with build data
 	return FullScanHashTable(key_type);
 }
 
@@ -53,39 +64,48 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 
 	// Scan the build keys in the hash table
 	Vector build_vector(key_type, key_count);
-	// layout??
 	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
 	// Now fill the selection vector using the build keys and create a sequential vector
-	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
 	SelectionVector sel_tuples(key_count + 1);
-
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
-
-	for (idx_t i = 0; i < key_count; i++) {
-		idx_mapping[sel_build.get_index(i)] = sel_tuples.get_index(i);
-	}
+	idx_t build_count;
+	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count, build_count);
 
 	// early out
 	if (!success) {
 		return false;
 	}
-	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
+	if (!HasBuildPayload()) {
+		// SEMI, ANTI and MARK joins only test the bitmap
+		return true;
+	}
+
+	const auto build_size = perfect_join_statistics.build_range + 1;
+	idx_t table_size = build_size;
+	if (has_duplicate_keys) {
+		// the rows are stored grouped by key instead of at the index of their key
+		GroupDuplicateKeys(sel_build, build_count);
+		table_size = build_count;
+	} else if (unique_keys == build_size && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
-	key_count = unique_keys; // do not consider keys out of the range
+	key_count = build_count; // do not consider keys out of the range
 
-	// Full scan the remaining build columns and fill the perfect hash table
+	for (idx_t i = 0; i < key_count; i++) {
+		idx_mapping[sel_build.get_index(i)] = sel_tuples.get_index(i);
+	}
+
+	// Full scan the build columns and fill the perfect hash table
 	//
 	// Filling is done by moving the data from the position sel_tuples[i] to the sel_build[i] for each column.
-	const auto build_size = perfect_join_statistics.build_range + 1;
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
-		auto &vector = perfect_hash_table[i];
+		perfect_hash_table.emplace_back(join.rhs_output_types[i], MaxValue<idx_t>(table_size, 1));
+		auto &vector = perfect_hash_table.back();
 		const auto output_col_idx = ht.output_columns[i];
 		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
-		if (build_size > STANDARD_VECTOR_SIZE) {
+		if (table_size > STANDARD_VECTOR_SIZE) {
 			auto &col_mask = FlatVector::Validity(vector);
-			col_mask.Initialize(build_size);
+			col_mask.Initialize(table_size);
 		}
 		data_collection.Gather(tuples_addresses, sel_tuples, key_count, output_col_idx, vector, sel_build, nullptr);
 	}
@@ -93,25 +113,50 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	return true;
 }
 
+void PerfectHashJoinExecutor::GroupDuplicateKeys(SelectionVector &sel_build, idx_t count) {
+	const auto build_size = perfect_join_statistics.build_range + 1;
+	build_offsets = make_unsafe_uniq_array<idx_t>(build_size + 1);
+	memset(build_offsets.get(), 0, sizeof(idx_t) * (build_size + 1));
+	// count the rows per key
+	for (idx_t i = 0; i < count; i++) {
+		build_offsets[sel_build.get_index(i) + 1]++;
+	}
+	// prefix sum: build_offsets[k] is now the first position of key k
+	for (idx_t k = 0; k < build_size; k++) {
+		build_offsets[k + 1] += build_offsets[k];
+	}
+	// assign the positions, this moves build_offsets[k] to the first position of key k + 1
+	for (idx_t i = 0; i < count; i++) {
+		auto key_idx = sel_build.get_index(i);
+		sel_build.set_index(i, build_offsets[key_idx]++);
+	}
+	// shift the offsets back
+	for (idx_t k = build_size; k > 0; k--) {
+		build_offsets[k] = build_offsets[k - 1];
+	}
+	build_offsets[0] = 0;
+}
+
 bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+                                                             SelectionVector &seq_sel_vec, idx_t count,
+                                                             idx_t &sel_count) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count, sel_count);
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
@@ -119,7 +164,8 @@ bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, Sel
 
 template <typename T>
 bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
+                                                                SelectionVector &seq_sel_vec, idx_t count,
+                                                                idx_t &sel_count) {
 	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
 		return false;
 	}
@@ -129,20 +175,21 @@ bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source,
 	source.ToUnifiedFormat(count, vector_data);
 	auto data = reinterpret_cast<T *>(vector_data.data);
 	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+	sel_count = 0;
+	for (idx_t i = 0; i < count; ++i) {
 		auto data_idx = vector_data.sel->get_index(i);
 		auto input_value = data[data_idx];
 		// add index to selection vector if value in the range
 		if (min_value <= input_value && input_value <= max_value) {
 			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
+			sel_vec.set_index(sel_count, idx);
+			if (HasBuildKey(idx)) {
+				has_duplicate_keys = true;
 			} else {
-				bitmap_build_idx[idx] = true;
+				SetBuildKey(idx);
 				unique_keys++;
 			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			seq_sel_vec.set_index(sel_count++, i);
 		}
 	}
 	return true;
@@ -168,22 +215,48 @@ public:
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
 	SelectionVector seq_sel_vec;
+
+	//! For duplicate build keys: the matches of the current input chunk that have not been fully emitted
+	idx_t match_count = 0;
+	idx_t match_idx = 0;
+	//! For duplicate build keys: the position in the build rows of the current match
+	idx_t build_position = 0;
+	SelectionVector result_build_sel;
+	SelectionVector result_probe_sel;
 };
 
-unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
-	auto state = make_uniq<PerfectHashJoinState>(context.client, join);
+unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context,
+                                                                    const PhysicalHashJoin &probe_op) {
+	// the probe expressions are taken from the operator that probes, which may not be the one that built the table
+	auto state = make_uniq<PerfectHashJoinState>(context.client, probe_op);
+	if (has_duplicate_keys) {
+		state->result_build_sel.Initialize(STANDARD_VECTOR_SIZE);
+		state->result_probe_sel.Initialize(STANDARD_VECTOR_SIZE);
+	}
 	return std::move(state);
 }
 
+OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
+                                                                  DataChunk &result, OperatorState &state,
+                                                                  const uint8_t *build_uuid) {
+	if (!HasBuildPayload()) {
+		return ProbeBitmap(input, result, state);
+	}
+	if (has_duplicate_keys) {
+		return ProbeDuplicateKeys(context, input, result, state, build_uuid);
+	}
+	return ProbeUniqueKeys(context, input, result, state, build_uuid);
+}
+
 // BUG: The size of build vec is not properly synced.
 //
 // For this function we need obtain the row information that describes for each joined tuple,
 // the indices of the tuples that were joined. Called by CachingPhysicalOperator::Execute
 //
 // Here, input is the "rhs table" where the "lhs table" is actually the payload held by the hash table.
-OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionContext &context, DataChunk &input,
-                                                                  DataChunk &result, OperatorState &state_p,
-                                                                  const uint8_t *build_uuid) {
+OperatorResultType PerfectHashJoinExecutor::ProbeUniqueKeys(ExecutionContext &context, DataChunk &input,
+                                                            DataChunk &result, OperatorState &state_p,
+                                                            const uint8_t *build_uuid) {
 	auto &state = state_p.Cast<PerfectHashJoinState>();
 	// keeps track of how many probe keys have a match
 	idx_t probe_sel_count = 0;
@@ -211,63 +284,175 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 		result.Slice(context.client, input, state.probe_sel_vec, probe_sel_count, 0);
 	}
 
+	// on the build side, we need to fetch the data and build dictionary vectors with the sel_vec
+	GatherBuildColumns(input, result, state.build_sel_vec, probe_sel_count);
+	CheckJoinPolicy(context, input, result, state.probe_sel_vec, state.build_sel_vec, probe_sel_count, build_uuid);
+
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorResultType PerfectHashJoinExecutor::ProbeDuplicateKeys(ExecutionContext &context, DataChunk &input,
+                                                               DataChunk &result, OperatorState &state_p,
+                                                               const uint8_t *build_uuid) {
+	auto &state = state_p.Cast<PerfectHashJoinState>();
+	if (state.match_idx == state.match_count) {
+		// new input chunk: find the probe rows that have a match (build_sel_vec holds the key index of each match)
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		state.match_count = 0;
+		state.match_idx = 0;
+		FillSelectionVectorSwitchProbe(state.join_keys.data[0], state.build_sel_vec, state.probe_sel_vec,
+		                               state.join_keys.size(), state.match_count);
+		if (state.match_count == 0) {
+			result.SetCardinality(0);
+			return OperatorResultType::NEED_MORE_INPUT;
+		}
+		state.build_position = build_offsets[state.build_sel_vec.get_index(0)];
+	}
+
+	// emit the build rows of the matches until the result is full
+	idx_t result_count = 0;
+	while (state.match_idx < state.match_count && result_count < STANDARD_VECTOR_SIZE) {
+		const auto key_idx = state.build_sel_vec.get_index(state.match_idx);
+		const auto probe_idx = state.probe_sel_vec.get_index(state.match_idx);
+		const auto build_end = build_offsets[key_idx + 1];
+		for (; state.build_position < build_end && result_count < STANDARD_VECTOR_SIZE; state.build_position++) {
+			state.result_build_sel.set_index(result_count, state.build_position);
+			state.result_probe_sel.set_index(result_count++, probe_idx);
+		}
+		if (state.build_position == build_end && ++state.match_idx < state.match_count) {
+			state.build_position = build_offsets[state.build_sel_vec.get_index(state.match_idx)];
+		}
+	}
+
+	result.Slice(context.client, input, state.result_probe_sel, result_count, 0);
+	GatherBuildColumns(input, result, state.result_build_sel, result_count);
+	CheckJoinPolicy(context, input, result, state.result_probe_sel, state.result_build_sel, result_count,
+	                build_uuid);
+
+	if (state.match_idx < state.match_count) {
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorResultType PerfectHashJoinExecutor::ProbeBitmap(DataChunk &input, DataChunk &result, OperatorState &state_p) {
+	auto &state = state_p.Cast<PerfectHashJoinState>();
+	state.join_keys.Reset();
+	state.probe_executor.Execute(input, state.join_keys);
+
+	// probe_sel_vec holds the rows that have a match (NULL keys never match)
+	idx_t match_count = 0;
+	auto &keys_vec = state.join_keys.data[0];
+	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, input.size(), match_count);
+
+	switch (join.join_type) {
+	case JoinType::SEMI:
+		result.Slice(input, state.probe_sel_vec, match_count);
+		break;
+	case JoinType::ANTI: {
+		idx_t result_count = 0;
+		for (idx_t i = 0, match_idx = 0; i < input.size(); i++) {
+			if (match_idx < match_count && state.probe_sel_vec.get_index(match_idx) == i) {
+				match_idx++;
+				continue;
+			}
+			state.seq_sel_vec.set_index(result_count++, i);
+		}
+		result.Slice(input, state.seq_sel_vec, result_count);
+		break;
+	}
+	case JoinType::MARK: {
+		result.SetCardinality(input);
+		for (idx_t i = 0; i < input.ColumnCount(); i++) {
+			result.data[i].Reference(input.data[i]);
+		}
+		auto &mark_vector = result.data.back();
+		mark_vector.SetVectorType(VectorType::FLAT_VECTOR);
+		auto bool_result = FlatVector::GetData<bool>(mark_vector);
+		auto &mask = FlatVector::Validity(mark_vector);
+		memset(bool_result, 0, sizeof(bool) * input.size());
+		for (idx_t i = 0; i < match_count; i++) {
+			bool_result[state.probe_sel_vec.get_index(i)] = true;
+		}
+		// a NULL key results in NULL, and if the build side contains NULL values, FALSE becomes NULL
+		UnifiedVectorFormat key_data;
+		keys_vec.ToUnifiedFormat(input.size(), key_data);
+		for (idx_t i = 0; i < input.size(); i++) {
+			if (!key_data.validity.RowIsValid(key_data.sel->get_index(i)) || (ht.has_null && !bool_result[i])) {
+				mask.SetInvalid(i);
+			}
+		}
+		break;
+	}
+	default:
+		throw InternalException("Unsupported join type for perfect hash join bitmap probe");
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+void PerfectHashJoinExecutor::GatherBuildColumns(DataChunk &input, DataChunk &result,
+                                                 const SelectionVector &build_sel, idx_t count) {
 	// on the build side, we need to fetch the data and build dictionary vectors with the sel_vec
 	for (idx_t i = 0; i < join.rhs_output_types.size(); i++) {
 		auto &result_vector = result.data[input.ColumnCount() + i];
 		D_ASSERT(result_vector.GetType() == ht.layout.GetTypes()[ht.output_columns[i]]);
 		auto &build_vec = perfect_hash_table[i];
 		result_vector.Reference(build_vec);
-		result_vector.Slice(state.build_sel_vec, probe_sel_count);
+		result_vector.Slice(build_sel, count);
 	}
+}
 
-	if (context.client.PolicyCheckingEnabled()) {
-		PicachvMessages::PlanArgument arg;
-		PicachvMessages::JoinInformation *join_info = arg.mutable_transform_info()->mutable_join();
-		google::protobuf::RepeatedPtrField<PicachvMessages::RowJoinInformation> *row_join_info =
-		    join_info->mutable_row_join_info();
+void PerfectHashJoinExecutor::CheckJoinPolicy(ExecutionContext &context, DataChunk &input, DataChunk &result,
+                                              const SelectionVector &probe_sel, const SelectionVector &build_sel,
+                                              idx_t count, const uint8_t *build_uuid) {
+	if (!context.client.PolicyCheckingEnabled()) {
+		return;
+	}
+	PicachvMessages::PlanArgument arg;
+	PicachvMessages::JoinInformation *join_info = arg.mutable_transform_info()->mutable_join();
+	google::protobuf::RepeatedPtrField<PicachvMessages::RowJoinInformation> *row_join_info =
+	    join_info->mutable_row_join_info();
 
-		for (idx_t i = 0; i < probe_sel_count; i++) {
-			idx_t left = state.probe_sel_vec.get_index(i);
-			idx_t right = state.build_sel_vec.get_index(i);
+	for (idx_t i = 0; i < count; i++) {
+		idx_t left = probe_sel.get_index(i);
+		idx_t right = build_sel.get_index(i);
 
-			if (idx_mapping.find(right) == idx_mapping.end()) {
-				throw InternalException("ProbePerfectHashTable: recover not found: " + std::to_string(right));
-			}
+		if (idx_mapping.find(right) == idx_mapping.end()) {
+			throw InternalException("ProbePerfectHashTable: recover not found: " + std::to_string(right));
+		}
 
-			right = idx_mapping[right];
+		right = idx_mapping[right];
 
-			PicachvMessages::RowJoinInformation row_info;
-			row_info.set_left_row(left);
-			row_info.set_right_row(right);
+		PicachvMessages::RowJoinInformation row_info;
+		row_info.set_left_row(left);
+		row_info.set_right_row(right);
 
-			row_join_info->Add(std::move(row_info));
-		}
+		row_join_info->Add(std::move(row_info));
+	}
 
-		join_info->mutable_lhs_df_uuid()->assign(reinterpret_cast<const char *>(input.GetActiveUUID()),
-		                                         PICACHV_UUID_LEN);
-		join_info->mutable_rhs_df_uuid()->assign(reinterpret_cast<const char *>(build_uuid), PICACHV_UUID_LEN);
+	join_info->mutable_lhs_df_uuid()->assign(reinterpret_cast<const char *>(input.GetActiveUUID()),
+	                                         PICACHV_UUID_LEN);
+	join_info->mutable_rhs_df_uuid()->assign(reinterpret_cast<const char *>(build_uuid), PICACHV_UUID_LEN);
 
-		for (size_t i = 0; i < input.ColumnCount(); i++) {
-			join_info->mutable_left_columns()->Add(i);
-		}
-		for (size_t i = 0; i < ht.output_columns.size(); i++) {
-			join_info->mutable_right_columns()->Add(ht.output_columns[i]);
-		}
+	for (size_t i = 0; i < input.ColumnCount(); i++) {
+		join_info->mutable_left_columns()->Add(i);
+	}
+	for (size_t i = 0; i < ht.output_columns.size(); i++) {
+		join_info->mutable_right_columns()->Add(ht.output_columns[i]);
+	}
 
-		// This step just ensures that we have set the proper protobuf field
-		// to indicate that we are doing a join but no other logic of computation.
-		(void)arg.mutable_transform();
-		duckdb_uuid_t uuid;
-		if (execute_epilogue(context.client.ctx_uuid.uuid, PICACHV_UUID_LEN, (uint8_t *)arg.SerializeAsString().c_str(),
-		                     arg.ByteSizeLong(), input.GetActiveUUID(), PICACHV_UUID_LEN, uuid.uuid,
-		                     PICACHV_UUID_LEN) != ErrorCode::Success) {
+	// This step just ensures that we have set the proper protobuf field
+	// to indicate that we are doing a join but no other logic of computation.
+	(void)arg.mutable_transform();
+	duckdb_uuid_t uuid;
+	if (execute_epilogue(context.client.ctx_uuid.uuid, PICACHV_UUID_LEN, (uint8_t *)arg.SerializeAsString().c_str(),
+	                     arg.ByteSizeLong(), input.GetActiveUUID(), PICACHV_UUID_LEN, uuid.uuid,
+	                     PICACHV_UUID_LEN) != ErrorCode::Success) {
 
-			throw InternalException("ProbePerfectHashTable: " + GetErrorMessage());
-		}
-		result.SetActiveUUID(uuid.uuid);
+		throw InternalException("ProbePerfectHashTable: " + GetErrorMessage());
 	}
-
-	return OperatorResultType::NEED_MORE_INPUT;
+	result.SetActiveUUID(uuid.uuid);
 }
 
 void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
@@ -324,7 +509,7 @@ void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source,
 			if (min_value <= input_value && input_value <= max_value) {
 				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
 				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
+				if (HasBuildKey(idx)) {
 					build_sel_vec.set_index(sel_idx, idx);
 					probe_sel_vec.set_index(sel_idx++, i);
 					probe_sel_count++;
@@ -343,7 +528,7 @@ void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source,
 			if (min_value <= input_value && input_value <= max_value) {
 				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
 				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
+				if (HasBuildKey(idx)) {
 					build_sel_vec.set_index(sel_idx, idx);
 					probe_sel_vec.set_index(sel_idx++, i);
 					probe_sel_count++;
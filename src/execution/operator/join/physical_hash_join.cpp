@@ -9,6 +9,7 @@
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/interrupt.hpp"
+#include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
@@ -107,6 +108,10 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+
+		if (op.filter_pushdown) {
+			global_filter_state = op.filter_pushdown->GetGlobalState(op);
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
@@ -146,6 +151,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The state of the filters pushed into the probe side (if any)
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -165,6 +173,10 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		if (op.filter_pushdown) {
+			local_filter_state = op.filter_pushdown->GetLocalState(op);
+		}
 	}
 
 public:
@@ -185,11 +197,15 @@ public:
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
+
+	//! Thread-local state of the filters pushed into the probe side (if any)
+	unique_ptr<JoinFilterLocalState> local_filter_state;
 };
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
 	auto result = make_uniq<JoinHashTable>(BufferManager::GetBufferManager(context), conditions, payload_types,
 	                                       join_type, rhs_output_columns);
+	result->pointer_table_layout = ht_layout;
 	if (!delim_types.empty() && join_type == JoinType::MARK) {
 		// correlated MARK join
 		if (delim_types.size() + 1 == conditions.size()) {
@@ -256,10 +272,17 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 // currently there is only one table involved; in the probe phase, the hash table is probed with the
 // join keys of the *larger* relation.
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
+	if (ProbesSharedBuild()) {
+		// the hash table of the building join is probed instead, so we stop reading the build side
+		return SinkResultType::FINISHED;
+	}
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 	// resolve the join keys for the right chunk
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
+	if (filter_pushdown) {
+		filter_pushdown->Sink(lstate.join_keys, *lstate.local_filter_state);
+	}
 
 	if (chunk.size() != 0) {
 		lstate.payload_chunks.emplace_back(*chunk.GetActiveUUIDArray());
@@ -302,6 +325,9 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		gstate.payload_chunks.insert(gstate.payload_chunks.end(), lstate.payload_chunks.begin(),
 		                             lstate.payload_chunks.end());
 	}
+	if (filter_pushdown) {
+		filter_pushdown->Combine(*gstate.global_filter_state, *lstate.local_filter_state);
+	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
 	client_profiler.Flush(context.thread.profiler);
@@ -471,6 +497,7 @@ public:
 		const auto num_partitions = RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits());
 		vector<idx_t> partition_sizes(num_partitions, 0);
 		vector<idx_t> partition_counts(num_partitions, 0);
+		sink.hash_table->GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
 		idx_t max_partition_size;
 		idx_t max_partition_count;
 		sink.hash_table->GetTotalSize(partition_sizes, partition_counts, max_partition_size, max_partition_count);
@@ -486,6 +513,12 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (ProbesSharedBuild()) {
+		sink.temporary_memory_state->SetRemainingSize(context, 0);
+		sink.finalized = true;
+		return SinkFinalizeType::READY;
+	}
+
 	if (!sink.payload_chunks.empty()) {
 		memcpy(sink.build_uuid.data(), sink.payload_chunks[0].data(), PICACHV_UUID_LEN);
 	}
@@ -506,24 +539,38 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		}
 	}
 
+	if (filter_pushdown) {
+		idx_t build_count = 0;
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_count += local_ht->GetSinkCollection().Count();
+		}
+		filter_pushdown->PushFilters(*this, *sink.global_filter_state, build_count);
+	}
+
 	idx_t max_partition_size;
 	idx_t max_partition_count;
 	auto const total_size = ht.GetTotalSize(sink.local_hash_tables, max_partition_size, max_partition_count);
 	sink.temporary_memory_state->SetRemainingSize(context, total_size);
 
 	sink.external = sink.temporary_memory_state->GetReservation() < total_size;
+	if (sink.external && shared_build) {
+		// a shared hash table is probed by multiple joins, so it cannot be built partition by partition: the other
+		// joins build their own hash tables instead
+		shared_build->unshared = true;
+	}
 	if (sink.external) {
 		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
 		// External Hash Join
 		sink.perfect_join_executor.reset();
-		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
+		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation() &&
+		    ht.SetRepartitionRadixBits(sink.local_hash_tables, sink.temporary_memory_state->GetReservation(),
+		                               max_partition_size, max_partition_count)) {
 			// We have to repartition
-			ht.SetRepartitionRadixBits(sink.local_hash_tables, sink.temporary_memory_state->GetReservation(),
-			                           max_partition_size, max_partition_count);
 			auto new_event = make_shared<HashJoinRepartitionEvent>(pipeline, sink, sink.local_hash_tables);
 			event.InsertEvent(std::move(new_event));
 		} else {
-			// No repartitioning!
+			// No repartitioning! (either it is not needed, or the largest partition consists of heavy hitter keys,
+			// which repartitioning cannot split up, so the partition is built on its own)
 			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size);
 			for (auto &local_ht : sink.local_hash_tables) {
 				ht.Merge(*local_ht);
@@ -590,10 +637,10 @@ public:
 
 unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &context) const {
 	auto &allocator = BufferAllocator::Get(context.client);
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 	auto state = make_uniq<HashJoinOperatorState>(context.client);
 	if (sink.perfect_join_executor) {
-		state->perfect_hash_join_state = sink.perfect_join_executor->GetOperatorState(context);
+		state->perfect_hash_join_state = sink.perfect_join_executor->GetOperatorState(context, *this);
 	} else {
 		state->join_keys.Initialize(allocator, condition_types);
 		for (auto &cond : conditions) {
@@ -616,7 +663,7 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
 	auto &state = state_p.Cast<HashJoinOperatorState>();
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 	D_ASSERT(sink.finalized);
 	D_ASSERT(!sink.scanned_data);
 
@@ -694,8 +741,7 @@ public:
 	bool AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate);
 
 	idx_t MaxThreads() override {
-		D_ASSERT(op.sink_state);
-		auto &gstate = op.sink_state->Cast<HashJoinGlobalSinkState>();
+		auto &gstate = op.GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 
 		idx_t count;
 		if (gstate.probe_spill) {
@@ -949,7 +995,7 @@ HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, A
 	auto &chunk_state = probe_local_scan.current_chunk_state;
 	chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
 
-	auto &sink = op.sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = op.GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 	probe_chunk.Initialize(allocator, sink.probe_types);
 	join_keys.Initialize(allocator, op.condition_types);
 	payload.Initialize(allocator, op.children[0]->types);
@@ -1066,7 +1112,7 @@ void HashJoinLocalSourceState::ExternalScanHT(HashJoinGlobalSinkState &sink, Has
 
 SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSourceInput &input) const {
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 	auto &gstate = input.global_state.Cast<HashJoinGlobalSourceState>();
 	auto &lstate = input.local_state.Cast<HashJoinLocalSourceState>();
 	sink.scanned_data = true;
@@ -1106,7 +1152,7 @@ SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk
 }
 
 double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &gstate_p) const {
-	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
+	auto &sink = GetBuildSinkState().Cast<HashJoinGlobalSinkState>();
 	auto &gstate = gstate_p.Cast<HashJoinGlobalSourceState>();
 
 	if (!sink.external) {
@@ -1135,6 +1181,55 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 	return progress * 100.0;
 }
 
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+GlobalSinkState &PhysicalHashJoin::GetBuildSinkState() const {
+	const PhysicalHashJoin &build_op = ProbesSharedBuild() ? *shared_build->build_op : *this;
+	D_ASSERT(build_op.sink_state);
+	return *build_op.sink_state;
+}
+
+bool PhysicalHashJoin::ProbesSharedBuild() const {
+	return shared_build && shared_build->build_op && shared_build->build_op.get() != this && !shared_build->unshared;
+}
+
+//! Returns the pipeline that builds the hash table of the join
+static shared_ptr<Pipeline> GetHashJoinBuildPipeline(MetaPipeline &meta_pipeline, const PhysicalHashJoin &join) {
+	vector<shared_ptr<MetaPipeline>> child_meta_pipelines;
+	meta_pipeline.GetMetaPipelines(child_meta_pipelines, true, true);
+	for (auto &child_meta_pipeline : child_meta_pipelines) {
+		if (child_meta_pipeline->GetSink().get() == &join) {
+			return child_meta_pipeline->GetBasePipeline();
+		}
+	}
+	throw InternalException("Could not find the build pipeline of a hash join");
+}
+
+void PhysicalHashJoin::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	if (!shared_build) {
+		PhysicalJoin::BuildPipelines(current, meta_pipeline);
+		return;
+	}
+	auto &state = meta_pipeline.GetState();
+	if (shared_build->build_op) {
+		auto entry = state.shared_hash_join_builds.find(*shared_build->build_op);
+		if (entry != state.shared_hash_join_builds.end()) {
+			// the hash table is already built by another join: our own build pipeline runs after that one is
+			// finished, and it stops right away unless the shared hash table did not fit in memory
+			auto build_dependency = entry->second.get().shared_from_this();
+			PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *this);
+			GetHashJoinBuildPipeline(meta_pipeline, *this)->AddDependency(build_dependency);
+			return;
+		}
+	}
+
+	// this is the first of the joins that share the hash table: this join builds it
+	shared_build->build_op = this;
+	PhysicalJoin::BuildJoinPipelines(current, meta_pipeline, *this);
+	state.shared_hash_join_builds.emplace(*this, *GetHashJoinBuildPipeline(meta_pipeline, *this));
+}
+
 string PhysicalHashJoin::ParamsToString() const {
 	string result = EnumUtil::ToString(join_type) + "\n";
 	for (auto &it : conditions) {
@@ -9,6 +9,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 
@@ -195,7 +196,7 @@ struct IEJoinUnion {
 	using SortedTable = PhysicalRangeJoin::GlobalSortedTable;
 
 	static idx_t AppendKey(SortedTable &table, ExpressionExecutor &executor, SortedTable &marked, int64_t increment,
-	                       int64_t base, const idx_t block_idx);
+	                       int64_t base, const idx_t block_idx, const idx_t entry_begin, const idx_t entry_end);
 
 	static void Sort(SortedTable &table) {
 		auto &global_sort_state = table.global_sort_state;
@@ -234,8 +235,18 @@ struct IEJoinUnion {
 		return result;
 	}
 
-	IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, SortedTable &t2,
-	            const idx_t b2);
+	//! Creates an empty L1 table: X/X', Y/Y', R/R'/Li
+	static unique_ptr<SortedTable> CreateL1(ClientContext &context, const PhysicalIEJoin &op);
+	//! Sorts the L1 keys of block b2 of t2, which are shared by all the unions that join with that block
+	static unique_ptr<SortedTable> SortRight(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t2,
+	                                         const idx_t b2);
+	//! Whether the entries [l_begin, l_end) of block b1 of t1 can have matches in block b2 of t2
+	static bool Overlaps(const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, const idx_t l_begin,
+	                     const idx_t l_end, SortedTable &t2, const idx_t b2);
+
+	//! Joins the entries [l_begin, l_end) of block b1 of t1 with the sorted RHS block r1 (if any)
+	IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, const idx_t l_begin,
+	            const idx_t l_end, optional_ptr<SortedTable> r1);
 
 	idx_t SearchL1(idx_t pos);
 	bool NextRow();
@@ -275,15 +286,16 @@ struct IEJoinUnion {
 };
 
 idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, SortedTable &marked, int64_t increment,
-                             int64_t base, const idx_t block_idx) {
+                             int64_t base, const idx_t block_idx, const idx_t entry_begin, const idx_t entry_end) {
 	LocalSortState local_sort_state;
 	local_sort_state.Initialize(marked.global_sort_state, marked.global_sort_state.buffer_manager);
 
 	// Reading
-	const auto valid = table.count - table.has_null;
 	auto &gstate = table.global_sort_state;
+	const auto block_start = block_idx * gstate.block_capacity;
+	const auto valid = MinValue<idx_t>(table.count - table.has_null, block_start + entry_end);
 	PayloadScanner scanner(gstate, block_idx);
-	auto table_idx = block_idx * gstate.block_capacity;
+	auto table_idx = block_start;
 
 	DataChunk scanned;
 	scanned.Initialize(Allocator::DefaultAllocator(), scanner.GetPayloadTypes());
@@ -314,7 +326,16 @@ idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, S
 		if (scan_count == 0) {
 			break;
 		}
+		// Skip the entries before the start of the slice
+		const auto slice_start = block_start + entry_begin;
+		const auto skip_count = table_idx < slice_start ? MinValue(scan_count, slice_start - table_idx) : 0;
 		table_idx += scan_count;
+		if (skip_count == scan_count) {
+			continue;
+		} else if (skip_count > 0) {
+			scan_count -= skip_count;
+			scanned.Slice(skip_count, scan_count);
+		}
 
 		// Compute the input columns from the payload
 		keys.Reset();
@@ -344,30 +365,7 @@ idx_t IEJoinUnion::AppendKey(SortedTable &table, ExpressionExecutor &executor, S
 	return inserted;
 }
 
-IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
-                         SortedTable &t2, const idx_t b2)
-    : n(0), i(0) {
-	// input : query Q with 2 join predicates t1.X op1 t2.X' and t1.Y op2 t2.Y', tables T, T' of sizes m and n resp.
-	// output: a list of tuple pairs (ti , tj)
-	// Note that T/T' are already sorted on X/X' and contain the payload data
-	// We only join the two block numbers and use the sizes of the blocks as the counts
-
-	// 0. Filter out tables with no overlap
-	if (!t1.BlockSize(b1) || !t2.BlockSize(b2)) {
-		return;
-	}
-
-	const auto &cmp1 = op.conditions[0].comparison;
-	SBIterator bounds1(t1.global_sort_state, cmp1);
-	SBIterator bounds2(t2.global_sort_state, cmp1);
-
-	// t1.X[0] op1 t2.X'[-1]
-	bounds1.SetIndex(bounds1.block_capacity * b1);
-	bounds2.SetIndex(bounds2.block_capacity * b2 + t2.BlockSize(b2) - 1);
-	if (!bounds1.Compare(bounds2)) {
-		return;
-	}
-
+unique_ptr<IEJoinUnion::SortedTable> IEJoinUnion::CreateL1(ClientContext &context, const PhysicalIEJoin &op) {
 	// 1. let L1 (resp. L2) be the array of column X (resp. Y )
 	const auto &order1 = op.lhs_orders[0];
 	const auto &order2 = op.lhs_orders[1];
@@ -389,44 +387,97 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 	vector<BoundOrderByNode> orders;
 	orders.emplace_back(order1.type, order1.null_order, std::move(ref));
 
-	l1 = make_uniq<SortedTable>(context, orders, payload_layout);
+	return make_uniq<SortedTable>(context, orders, payload_layout);
+}
 
-	// LHS has positive rids
-	ExpressionExecutor l_executor(context);
-	l_executor.AddExpression(*order1.expression);
-	l_executor.AddExpression(*order2.expression);
-	AppendKey(t1, l_executor, *l1, 1, 1, b1);
+unique_ptr<IEJoinUnion::SortedTable> IEJoinUnion::SortRight(ClientContext &context, const PhysicalIEJoin &op,
+                                                            SortedTable &t2, const idx_t b2) {
+	auto r1 = CreateL1(context, op);
 
 	// RHS has negative rids
 	ExpressionExecutor r_executor(context);
 	r_executor.AddExpression(*op.rhs_orders[0].expression);
 	r_executor.AddExpression(*op.rhs_orders[1].expression);
-	AppendKey(t2, r_executor, *l1, -1, -1, b2);
+	AppendKey(t2, r_executor, *r1, -1, -1, b2, 0, t2.BlockSize(b2));
+
+	if (!r1->global_sort_state.sorted_blocks.empty()) {
+		Sort(*r1);
+	}
+
+	return r1;
+}
+
+bool IEJoinUnion::Overlaps(const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1, const idx_t l_begin,
+                           const idx_t l_end, SortedTable &t2, const idx_t b2) {
+	// 0. Filter out tables with no overlap
+	if (l_begin >= l_end || !t2.BlockSize(b2)) {
+		return false;
+	}
+
+	const auto &cmp1 = op.conditions[0].comparison;
+	SBIterator bounds1(t1.global_sort_state, cmp1);
+	SBIterator bounds2(t2.global_sort_state, cmp1);
+
+	// t1.X[0] op1 t2.X'[-1]
+	bounds1.SetIndex(bounds1.block_capacity * b1 + l_begin);
+	bounds2.SetIndex(bounds2.block_capacity * b2 + t2.BlockSize(b2) - 1);
+	return bounds1.Compare(bounds2);
+}
+
+IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, SortedTable &t1, const idx_t b1,
+                         const idx_t l_begin, const idx_t l_end, optional_ptr<SortedTable> r1)
+    : n(0), i(0) {
+	// input : query Q with 2 join predicates t1.X op1 t2.X' and t1.Y op2 t2.Y', tables T, T' of sizes m and n resp.
+	// output: a list of tuple pairs (ti , tj)
+	// Note that T/T' are already sorted on X/X' and contain the payload data
+	// We only join the two block numbers and use the sizes of the blocks as the counts
+
+	// The RHS block is missing if it does not overlap with the slice
+	if (!r1 || r1->global_sort_state.sorted_blocks.empty()) {
+		return;
+	}
+
+	l1 = CreateL1(context, op);
+
+	// LHS has positive rids (relative to the start of the block)
+	ExpressionExecutor l_executor(context);
+	l_executor.AddExpression(*op.lhs_orders[0].expression);
+	l_executor.AddExpression(*op.lhs_orders[1].expression);
+	AppendKey(t1, l_executor, *l1, 1, int64_t(l_begin) + 1, b1, l_begin, l_end);
 
 	if (l1->global_sort_state.sorted_blocks.empty()) {
 		return;
 	}
 
+	// The RHS keys are already sorted, so we only merge a (read-only) copy of them with the LHS keys
+	auto &l1_state = l1->global_sort_state;
+	D_ASSERT(l1_state.external == r1->global_sort_state.external);
+	l1_state.sorted_blocks.push_back(r1->global_sort_state.sorted_blocks[0]->CreateCopy(l1_state));
+	l1->count += r1->count.load();
+
 	Sort(*l1);
 
-	op1 = make_uniq<SBIterator>(l1->global_sort_state, cmp1);
-	off1 = make_uniq<SBIterator>(l1->global_sort_state, cmp1);
+	const auto &cmp1 = op.conditions[0].comparison;
+	op1 = make_uniq<SBIterator>(l1_state, cmp1);
+	off1 = make_uniq<SBIterator>(l1_state, cmp1);
 
 	// We don't actually need the L1 column, just its sort key, which is in the sort blocks
-	li = ExtractColumn<int64_t>(*l1, types.size() - 1);
+	li = ExtractColumn<int64_t>(*l1, l1_state.payload_layout.ColumnCount() - 1);
 
 	// 4. if (op2 ∈ {>, ≥}) sort L2 in ascending order
 	// 5. else if (op2 ∈ {<, ≤}) sort L2 in descending order
 
 	// We sort on Y/Y' to obtain the sort keys and the permutation array.
 	// For this we just need a two-column table of Y, P
-	types.clear();
+	vector<LogicalType> types;
 	types.emplace_back(LogicalType::BIGINT);
+	RowLayout payload_layout;
 	payload_layout.Initialize(types);
 
 	// Sort on the first expression
-	orders.clear();
-	ref = make_uniq<BoundReferenceExpression>(order2.expression->return_type, 0);
+	const auto &order2 = op.lhs_orders[1];
+	vector<BoundOrderByNode> orders;
+	auto ref = make_uniq<BoundReferenceExpression>(order2.expression->return_type, 0);
 	orders.emplace_back(order2.type, order2.null_order, std::move(ref));
 
 	ExpressionExecutor executor(context);
@@ -434,7 +485,7 @@ IEJoinUnion::IEJoinUnion(ClientContext &context, const PhysicalIEJoin &op, Sorte
 
 	l2 = make_uniq<SortedTable>(context, orders, payload_layout);
 	for (idx_t base = 0, block_idx = 0; block_idx < l1->BlockCount(); ++block_idx) {
-		base += AppendKey(*l1, executor, *l2, 1, base, block_idx);
+		base += AppendKey(*l1, executor, *l2, 1, base, block_idx, 0, l1->BlockSize(block_idx));
 	}
 
 	Sort(*l2);
@@ -790,9 +841,28 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &re
 
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
-	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op)
-	    : op(op), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0), right_outers(0),
-	      next_right(0) {
+	//! The minimum number of LHS entries in a slice of a block
+	static constexpr const idx_t MIN_SLICE_SIZE = 16 * STANDARD_VECTOR_SIZE;
+
+	//! A range of entries in a LHS block that is joined with each RHS block by a single task
+	struct LeftSlice {
+		idx_t block_idx;
+		idx_t begin;
+		idx_t end;
+	};
+
+	//! The L1 keys of a RHS block, sorted once and shared by all the slices that join with it
+	struct SortedRight {
+		mutex lock;
+		unique_ptr<IEJoinUnion::SortedTable> table;
+		//! The number of slices that still have to join with the block
+		atomic<idx_t> remaining;
+	};
+
+public:
+	IEJoinGlobalSourceState(const PhysicalIEJoin &op, ClientContext &context)
+	    : op(op), num_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()), initialized(false),
+	      next_pair(0), completed(0), left_outers(0), next_left(0), right_outers(0), next_right(0) {
 	}
 
 	void Initialize(IEJoinGlobalState &sink_state) {
@@ -801,6 +871,29 @@ public:
 			return;
 		}
 
+		// The sorted blocks can be large, so if there are fewer block pairs than threads,
+		// we split the LHS blocks into slices that are joined independently
+		auto &lhs_table = *sink_state.tables[0];
+		auto &rhs_table = *sink_state.tables[1];
+		const auto block_pairs = lhs_table.BlockCount() * rhs_table.BlockCount();
+		idx_t slices_per_block = 1;
+		if (block_pairs > 0 && block_pairs < num_threads) {
+			slices_per_block = (num_threads + block_pairs - 1) / block_pairs;
+		}
+		for (idx_t block_idx = 0; block_idx < lhs_table.BlockCount(); ++block_idx) {
+			const auto block_size = lhs_table.BlockSize(block_idx);
+			auto slice_size = (block_size + slices_per_block - 1) / slices_per_block;
+			slice_size = AlignValue<idx_t, STANDARD_VECTOR_SIZE>(MaxValue(slice_size, MIN_SLICE_SIZE));
+			for (idx_t begin = 0; begin < block_size; begin += slice_size) {
+				left_slices.push_back({block_idx, begin, MinValue(begin + slice_size, block_size)});
+			}
+		}
+
+		for (idx_t block_idx = 0; block_idx < rhs_table.BlockCount(); ++block_idx) {
+			sorted_right.emplace_back(make_uniq<SortedRight>());
+			sorted_right.back()->remaining = left_slices.size();
+		}
+
 		// Compute the starting row for reach block
 		// (In theory these are all the same size, but you never know...)
 		auto &left_table = *sink_state.tables[0];
@@ -835,23 +928,24 @@ public:
 
 public:
 	idx_t MaxThreads() override {
-		// We can't leverage any more threads than block pairs.
-		const auto &sink_state = (op.sink_state->Cast<IEJoinGlobalState>());
-		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
+		// We can't leverage any more threads than (sliced) block pairs.
+		auto &sink_state = op.sink_state->Cast<IEJoinGlobalState>();
+		Initialize(sink_state);
+		return left_slices.size() * sink_state.tables[1]->BlockCount();
 	}
 
 	void GetNextPair(ClientContext &client, IEJoinGlobalState &gstate, IEJoinLocalSourceState &lstate) {
 		auto &left_table = *gstate.tables[0];
 		auto &right_table = *gstate.tables[1];
 
-		const auto left_blocks = left_table.BlockCount();
 		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
+		const auto pair_count = left_slices.size() * right_blocks;
 
 		// Regular block
 		const auto i = next_pair++;
 		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
+			const auto &slice = left_slices[i / right_blocks];
+			const auto b1 = slice.block_idx;
 			const auto b2 = i % right_blocks;
 
 			lstate.left_block_index = b1;
@@ -860,7 +954,11 @@ public:
 			lstate.right_block_index = b2;
 			lstate.right_base = right_bases[b2];
 
-			lstate.joiner = make_uniq<IEJoinUnion>(client, op, left_table, b1, right_table, b2);
+			optional_ptr<IEJoinUnion::SortedTable> r1;
+			if (IEJoinUnion::Overlaps(op, left_table, b1, slice.begin, slice.end, right_table, b2)) {
+				r1 = &GetSortedRight(client, right_table, b2);
+			}
+			lstate.joiner = make_uniq<IEJoinUnion>(client, op, left_table, b1, slice.begin, slice.end, r1);
 			return;
 		}
 
@@ -905,18 +1003,37 @@ public:
 		}
 	}
 
+	IEJoinUnion::SortedTable &GetSortedRight(ClientContext &client, IEJoinUnion::SortedTable &right_table,
+	                                         const idx_t b2) {
+		auto &right = *sorted_right[b2];
+		lock_guard<mutex> sorting(right.lock);
+		if (!right.table) {
+			right.table = IEJoinUnion::SortRight(client, op, right_table, b2);
+		}
+		return *right.table;
+	}
+
 	void PairCompleted(ClientContext &client, IEJoinGlobalState &gstate, IEJoinLocalSourceState &lstate) {
 		lstate.joiner.reset();
+		// Release the sorted RHS keys once the last slice has joined with them
+		auto &right = *sorted_right[lstate.right_block_index];
+		if (--right.remaining == 0) {
+			lock_guard<mutex> releasing(right.lock);
+			right.table.reset();
+		}
 		++completed;
 		GetNextPair(client, gstate, lstate);
 	}
 
 	const PhysicalIEJoin &op;
+	const idx_t num_threads;
 
 	mutex lock;
 	bool initialized;
 
 	// Join queue state
+	vector<LeftSlice> left_slices;
+	vector<unique_ptr<SortedRight>> sorted_right;
 	std::atomic<size_t> next_pair;
 	std::atomic<size_t> completed;
 
@@ -933,7 +1050,7 @@ public:
 };
 
 unique_ptr<GlobalSourceState> PhysicalIEJoin::GetGlobalSourceState(ClientContext &context) const {
-	return make_uniq<IEJoinGlobalSourceState>(*this);
+	return make_uniq<IEJoinGlobalSourceState>(*this, context);
 }
 
 unique_ptr<LocalSourceState> PhysicalIEJoin::GetLocalSourceState(ExecutionContext &context,
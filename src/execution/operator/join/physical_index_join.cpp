@@ -0,0 +1,296 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+//! Returns the column of the table that column "column_index" of the table scan produces
+static column_t GetScanColumn(const PhysicalTableScan &scan, idx_t column_index) {
+	if (!scan.projection_ids.empty()) {
+		column_index = scan.projection_ids[column_index];
+	}
+	return scan.column_ids[column_index];
+}
+
+PhysicalIndexJoin::PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, PhysicalTableScan &scan,
+                                     JoinCondition condition, bool lhs_first, ART &index,
+                                     const vector<idx_t> &left_projection_map,
+                                     const vector<idx_t> &right_projection_map, idx_t estimated_cardinality)
+    : CachingPhysicalOperator(PhysicalOperatorType::INDEX_JOIN, op.types, estimated_cardinality),
+      table(scan.bind_data->Cast<TableScanBindData>().table), index(index), lhs_first(lhs_first) {
+	D_ASSERT(condition.comparison == ExpressionType::COMPARE_EQUAL);
+	probe_key = lhs_first ? std::move(condition.left) : std::move(condition.right);
+
+	auto &probe_projection_map = lhs_first ? left_projection_map : right_projection_map;
+	if (probe_projection_map.empty()) {
+		for (idx_t col_idx = 0; col_idx < probe->types.size(); col_idx++) {
+			probe_projection.push_back(col_idx);
+		}
+	} else {
+		probe_projection = probe_projection_map;
+	}
+
+	// only fetch the columns of the table that are part of the output
+	auto &scan_projection_map = lhs_first ? right_projection_map : left_projection_map;
+	auto scan_column_count = scan_projection_map.empty() ? scan.types.size() : scan_projection_map.size();
+	for (idx_t i = 0; i < scan_column_count; i++) {
+		auto col_idx = scan_projection_map.empty() ? i : scan_projection_map[i];
+		auto column_id = GetScanColumn(scan, col_idx);
+		if (column_id != COLUMN_IDENTIFIER_ROW_ID) {
+			column_id = table.GetColumn(LogicalIndex(column_id)).StorageOid();
+		}
+		fetch_ids.push_back(column_id);
+		fetch_types.push_back(scan.types[col_idx]);
+	}
+	// the row ids are fetched as well, to match the fetched rows with their probe rows
+	fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	fetch_types.push_back(LogicalType::ROW_TYPE);
+
+	children.push_back(std::move(probe));
+}
+
+optional_ptr<ART> PhysicalIndexJoin::FindJoinIndex(ClientContext &context, PhysicalOperator &op,
+                                                   const Expression &key) {
+	if (op.type != PhysicalOperatorType::TABLE_SCAN || key.type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	auto &scan = op.Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || scan.dynamic_filters ||
+	    (scan.table_filters && !scan.table_filters->filters.empty())) {
+		return nullptr;
+	}
+	auto column_id = GetScanColumn(scan, key.Cast<BoundReferenceExpression>().index);
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	auto &storage = table.GetStorage();
+	// the index refers to its columns by their storage ids
+	column_id = table.GetColumn(LogicalIndex(column_id)).StorageOid();
+	optional_ptr<ART> result;
+	storage.info->indexes.Scan([&](Index &index) {
+		if (index.IsUnknown() || index.index_type != ART::TYPE_NAME) {
+			return false;
+		}
+		if (index.column_ids.size() != 1 || index.column_ids[0] != column_id ||
+		    index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+		    index.logical_types[0] != key.return_type) {
+			return false;
+		}
+		result = &index.Cast<ART>();
+		return true;
+	});
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ExecutionContext &context, const PhysicalIndexJoin &op)
+	    : arena_allocator(Allocator::Get(context.client)), probe_executor(context.client, *op.probe_key),
+	      keys(STANDARD_VECTOR_SIZE), probe_sel(STANDARD_VECTOR_SIZE), initialized(false), position(0),
+	      local_start(0), local_allocator(Allocator::Get(context.client)), local_initialized(false) {
+		probe_keys.Initialize(Allocator::Get(context.client), {op.probe_key->return_type});
+		fetch_chunk.Initialize(Allocator::Get(context.client), op.fetch_types);
+	}
+
+	ArenaAllocator arena_allocator;
+	ExpressionExecutor probe_executor;
+	DataChunk probe_keys;
+	vector<ARTKey> keys;
+	//! The matches of the current input chunk: the input row and the row id of the table row
+	vector<sel_t> probe_rows;
+	vector<row_t> row_ids;
+
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	SelectionVector probe_sel;
+
+	bool initialized;
+	//! The next match to fetch
+	idx_t position;
+	//! The first match that is a transaction-local row, all later matches are transaction-local as well
+	idx_t local_start;
+
+	//! The sorted keys of the transaction-local rows of the table, and their row ids
+	ArenaAllocator local_allocator;
+	vector<pair<ARTKey, row_t>> local_keys;
+	bool local_initialized;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context, *this);
+}
+
+void PhysicalIndexJoin::ProbeIndex(ExecutionContext &context, DataChunk &input, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	state.probe_rows.clear();
+	state.row_ids.clear();
+	state.position = 0;
+
+	state.arena_allocator.Reset();
+	state.probe_keys.Reset();
+	state.probe_executor.Execute(input, state.probe_keys);
+	ART::GenerateKeys(state.arena_allocator, state.probe_keys, state.keys);
+
+	// probe the keys in sorted order: neighbouring lookups then share most of their path through the tree, and the
+	// matching rows of ascending keys are fetched in (mostly) ascending row id order
+	vector<sel_t> order;
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (!state.keys[i].Empty()) {
+			// NULL keys do not have a join partner
+			order.push_back(UnsafeNumericCast<sel_t>(i));
+		}
+	}
+	auto &keys = state.keys;
+	std::sort(order.begin(), order.end(), [&](sel_t lhs, sel_t rhs) { return keys[rhs] > keys[lhs]; });
+
+	index.SearchEqualSorted(keys, order, state.row_ids, state.probe_rows);
+
+	// the transaction-local rows are matched after the rows in the index
+	state.local_start = state.row_ids.size();
+	if (state.local_keys.empty()) {
+		return;
+	}
+	auto &local_keys = state.local_keys;
+	for (auto probe_row : order) {
+		auto &key = keys[probe_row];
+		auto entry = std::lower_bound(local_keys.begin(), local_keys.end(), key,
+		                              [](const pair<ARTKey, row_t> &lhs, const ARTKey &rhs) { return rhs > lhs.first; });
+		for (; entry != local_keys.end() && entry->first == key; entry++) {
+			state.row_ids.push_back(entry->second);
+			state.probe_rows.push_back(probe_row);
+		}
+	}
+}
+
+void PhysicalIndexJoin::InitializeLocalRows(ExecutionContext &context, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	state.local_initialized = true;
+	// the local storage is checked when executing, so that prepared statements see the appends of their transaction
+	auto &local_storage = LocalStorage::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+	if (!local_storage.Find(storage)) {
+		return;
+	}
+
+	TableScanState scan_state;
+	scan_state.Initialize({index.column_ids[0], COLUMN_IDENTIFIER_ROW_ID});
+	local_storage.InitializeScan(storage, scan_state.local_state, nullptr);
+
+	DataChunk local_chunk;
+	local_chunk.Initialize(Allocator::Get(context.client), {index.logical_types[0], LogicalType::ROW_TYPE});
+	DataChunk key_chunk;
+	key_chunk.InitializeEmpty({index.logical_types[0]});
+	vector<ARTKey> local_keys(STANDARD_VECTOR_SIZE);
+	while (true) {
+		local_chunk.Reset();
+		local_storage.Scan(scan_state.local_state, scan_state.GetColumnIds(), local_chunk);
+		if (local_chunk.size() == 0) {
+			break;
+		}
+		key_chunk.data[0].Reference(local_chunk.data[0]);
+		key_chunk.SetCardinality(local_chunk);
+		ART::GenerateKeys(state.local_allocator, key_chunk, local_keys);
+
+		local_chunk.data[1].Flatten(local_chunk.size());
+		auto row_ids = FlatVector::GetData<row_t>(local_chunk.data[1]);
+		for (idx_t i = 0; i < local_chunk.size(); i++) {
+			if (!local_keys[i].Empty()) {
+				state.local_keys.emplace_back(local_keys[i], row_ids[i]);
+			}
+		}
+	}
+	std::sort(state.local_keys.begin(), state.local_keys.end(),
+	          [](const pair<ARTKey, row_t> &lhs, const pair<ARTKey, row_t> &rhs) { return rhs.first > lhs.first; });
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	if (!state.local_initialized) {
+		InitializeLocalRows(context, state);
+	}
+	if (!state.initialized) {
+		ProbeIndex(context, input, state);
+		state.initialized = true;
+	}
+
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+	auto probe_offset = lhs_first ? 0 : fetch_ids.size() - 1;
+	auto fetch_offset = lhs_first ? probe_projection.size() : 0;
+	while (state.position < state.row_ids.size()) {
+		// a fetch either reads rows of the table or transaction-local rows
+		const auto is_local = state.position >= state.local_start;
+		const auto fetch_end = is_local ? state.row_ids.size() : state.local_start;
+		auto fetch_count = MinValue<idx_t>(fetch_end - state.position, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.position));
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			LocalStorage::Get(context.client, table.catalog)
+			    .FetchChunk(storage, row_ids, fetch_count, fetch_ids, state.fetch_chunk, state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, fetch_ids, row_ids, fetch_count, state.fetch_state);
+		}
+
+		// rows that are not visible to this transaction are skipped by the fetch: match the fetched rows with the
+		// probe rows through their row ids
+		auto fetched_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+		auto match_idx = state.position;
+		for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+			while (state.row_ids[match_idx] != fetched_ids[i]) {
+				match_idx++;
+			}
+			state.probe_sel.set_index(i, state.probe_rows[match_idx++]);
+		}
+		state.position += fetch_count;
+		if (state.fetch_chunk.size() == 0) {
+			continue;
+		}
+
+		for (idx_t i = 0; i < probe_projection.size(); i++) {
+			chunk.data[probe_offset + i].Slice(input.data[probe_projection[i]], state.probe_sel,
+			                                   state.fetch_chunk.size());
+		}
+		for (idx_t i = 0; i + 1 < fetch_ids.size(); i++) {
+			chunk.data[fetch_offset + i].Reference(state.fetch_chunk.data[i]);
+		}
+		chunk.SetCardinality(state.fetch_chunk.size());
+		if (state.position < state.row_ids.size()) {
+			return OperatorResultType::HAVE_MORE_OUTPUT;
+		}
+		break;
+	}
+	state.initialized = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+string PhysicalIndexJoin::ParamsToString() const {
+	string result = table.name + "\n";
+	result += probe_key->GetName() + " = " + index.name + "\n";
+	result += "\n[INFOSEPARATOR]\n";
+	result += StringUtil::Format("EC: %llu\n", estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -38,6 +38,16 @@ PhysicalPiecewiseMergeJoin::PhysicalPiecewiseMergeJoin(LogicalComparisonJoin &op
 			lhs_orders.emplace_back(OrderType::DESCENDING, OrderByNullType::NULLS_LAST, std::move(left));
 			rhs_orders.emplace_back(OrderType::DESCENDING, OrderByNullType::NULLS_LAST, std::move(right));
 			break;
+		case ExpressionType::COMPARE_EQUAL:
+			if (lhs_orders.empty()) {
+				// equi-join: both sides are sorted on the first key and merged
+				lhs_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(left));
+				rhs_orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(right));
+			} else {
+				lhs_orders.emplace_back(OrderType::INVALID, OrderByNullType::NULLS_LAST, std::move(left));
+				rhs_orders.emplace_back(OrderType::INVALID, OrderByNullType::NULLS_LAST, std::move(right));
+			}
+			break;
 		case ExpressionType::COMPARE_NOTEQUAL:
 		case ExpressionType::COMPARE_DISTINCT_FROM:
 			// Allowed in multi-predicate joins, but can't be first/sort.
@@ -47,7 +57,6 @@ PhysicalPiecewiseMergeJoin::PhysicalPiecewiseMergeJoin(LogicalComparisonJoin &op
 			break;
 
 		default:
-			// COMPARE EQUAL not supported with merge join
 			throw NotImplementedException("Unimplemented join type for merge join");
 		}
 	}
@@ -165,7 +174,7 @@ public:
 	    : context(context), allocator(Allocator::Get(context)), op(op),
 	      buffer_manager(BufferManager::GetBufferManager(context)), force_external(force_external),
 	      left_outer(IsLeftOuterJoin(op.join_type)), left_position(0), first_fetch(true), finished(true),
-	      right_position(0), right_chunk_index(0), rhs_executor(context) {
+	      right_position(0), right_scan(0), right_chunk_index(0), rhs_executor(context) {
 		vector<LogicalType> condition_types;
 		for (auto &order : op.lhs_orders) {
 			condition_types.push_back(order.expression->return_type);
@@ -208,6 +217,8 @@ public:
 	bool first_fetch;
 	bool finished;
 	idx_t right_position;
+	//! For equi-joins: the position in the run of equal right keys that is being emitted
+	idx_t right_scan;
 	idx_t right_chunk_index;
 	idx_t right_base;
 	idx_t prev_left_index;
@@ -524,6 +535,113 @@ static idx_t MergeJoinComplexBlocks(BlockMergeInfo &l, BlockMergeInfo &r, const
 	return result_count;
 }
 
+static idx_t MergeJoinEqualityBlocks(BlockMergeInfo &l, BlockMergeInfo &r, idx_t &right_scan) {
+	// The sort parameters should all be the same
+	D_ASSERT(l.state.sort_layout.all_constant == r.state.sort_layout.all_constant);
+	const auto all_constant = r.state.sort_layout.all_constant;
+	D_ASSERT(l.state.external == r.state.external);
+	const auto external = l.state.external;
+
+	// There should only be one sorted block if they have been sorted
+	D_ASSERT(l.state.sorted_blocks.size() == 1);
+	SBScanState lread(l.state.buffer_manager, l.state);
+	lread.sb = l.state.sorted_blocks[0].get();
+	D_ASSERT(lread.sb->radix_sorting_data.size() == 1);
+	MergeJoinPinSortingBlock(lread, l.block_idx);
+
+	D_ASSERT(r.state.sorted_blocks.size() == 1);
+	SBScanState rread(r.state.buffer_manager, r.state);
+	rread.sb = r.state.sorted_blocks[0].get();
+
+	if (r.entry_idx >= r.not_null) {
+		return 0;
+	}
+	MergeJoinPinSortingBlock(rread, r.block_idx);
+
+	const auto cmp_size = l.state.sort_layout.comparison_size;
+	auto compare = [&](const idx_t l_entry_idx, const idx_t r_entry_idx) {
+		auto l_ptr = MergeJoinRadixPtr(lread, l_entry_idx);
+		auto r_ptr = MergeJoinRadixPtr(rread, r_entry_idx);
+		if (all_constant) {
+			return FastMemcmp(l_ptr, r_ptr, cmp_size);
+		}
+		return Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, l.state.sort_layout, external);
+	};
+
+	// r.entry_idx is the start of the run of right entries that are not smaller than the current left entry,
+	// right_scan is the next entry of that run to match with the current left entry
+	idx_t result_count = 0;
+	while (l.entry_idx < l.not_null && r.entry_idx < r.not_null) {
+		if (right_scan == r.entry_idx) {
+			const auto comp_res = compare(l.entry_idx, r.entry_idx);
+			if (comp_res < 0) {
+				// left side smaller: no match for this left entry
+				l.entry_idx++;
+				continue;
+			}
+			if (comp_res > 0) {
+				// right side smaller: binary search for the first right entry that is not smaller
+				idx_t lower = r.entry_idx + 1;
+				idx_t upper = r.not_null;
+				while (lower < upper) {
+					const auto middle = lower + (upper - lower) / 2;
+					if (compare(l.entry_idx, middle) > 0) {
+						lower = middle + 1;
+					} else {
+						upper = middle;
+					}
+				}
+				r.entry_idx = lower;
+				right_scan = lower;
+				continue;
+			}
+		}
+		// emit the run of equal right entries for the current left entry
+		while (right_scan < r.not_null && compare(l.entry_idx, right_scan) == 0) {
+			l.result.set_index(result_count, sel_t(l.entry_idx));
+			r.result.set_index(result_count, sel_t(right_scan));
+			result_count++;
+			right_scan++;
+			if (result_count == STANDARD_VECTOR_SIZE) {
+				// out of space!
+				return result_count;
+			}
+		}
+		// the next left entry may have the same key, so we start at the beginning of the run again
+		l.entry_idx++;
+		right_scan = r.entry_idx;
+	}
+
+	return result_count;
+}
+
+//! Whether the largest key of the right block is bigger than all left keys, so that the following right blocks, which
+//! only have bigger or equal keys, cannot match any left entry
+static bool MergeJoinRightExceedsLeft(BlockMergeInfo &l, BlockMergeInfo &r) {
+	if (l.not_null == 0 || r.not_null == 0) {
+		return false;
+	}
+	D_ASSERT(l.state.sorted_blocks.size() == 1);
+	SBScanState lread(l.state.buffer_manager, l.state);
+	lread.sb = l.state.sorted_blocks[0].get();
+	MergeJoinPinSortingBlock(lread, l.block_idx);
+	auto l_ptr = MergeJoinRadixPtr(lread, l.not_null - 1);
+
+	D_ASSERT(r.state.sorted_blocks.size() == 1);
+	SBScanState rread(r.state.buffer_manager, r.state);
+	rread.sb = r.state.sorted_blocks[0].get();
+	MergeJoinPinSortingBlock(rread, r.block_idx);
+	auto r_ptr = MergeJoinRadixPtr(rread, r.not_null - 1);
+
+	int comp_res;
+	if (r.state.sort_layout.all_constant) {
+		comp_res = FastMemcmp(l_ptr, r_ptr, l.state.sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(lread, rread, l_ptr, r_ptr, l.state.sort_layout, l.state.external);
+	}
+	return comp_res < 0;
+}
+
 OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &chunk, OperatorState &state_p) const {
 	auto &state = state_p.Cast<PiecewiseMergeJoinState>();
@@ -531,6 +649,7 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 	auto &rsorted = *gstate.table->global_sort_state.sorted_blocks[0];
 	const auto left_cols = input.ColumnCount();
 	const auto tail_cols = conditions.size() - 1;
+	const auto is_equality = conditions[0].comparison == ExpressionType::COMPARE_EQUAL;
 
 	state.payload_heap_handles.clear();
 	do {
@@ -542,6 +661,7 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 			state.left_position = 0;
 			state.prev_left_index = 0;
 			state.right_position = 0;
+			state.right_scan = 0;
 			state.first_fetch = false;
 			state.finished = false;
 		}
@@ -567,16 +687,25 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 		BlockMergeInfo right_info(gstate.table->global_sort_state, state.right_chunk_index, state.right_position,
 		                          rhs_not_null);
 
-		idx_t result_count =
-		    MergeJoinComplexBlocks(left_info, right_info, conditions[0].comparison, state.prev_left_index);
+		idx_t result_count;
+		if (is_equality) {
+			result_count = MergeJoinEqualityBlocks(left_info, right_info, state.right_scan);
+		} else {
+			result_count =
+			    MergeJoinComplexBlocks(left_info, right_info, conditions[0].comparison, state.prev_left_index);
+		}
 		if (result_count == 0) {
+			// for equi-joins, if the last key of this right chunk is bigger than all left keys,
+			// the keys in the next right chunks are bigger than all left keys too
+			const auto no_more_matches = is_equality && MergeJoinRightExceedsLeft(left_info, right_info);
 			// exhausted this chunk on the right side
 			// move to the next right chunk
 			state.left_position = 0;
 			state.right_position = 0;
+			state.right_scan = 0;
 			state.right_base += rsorted.radix_sorting_data[state.right_chunk_index]->count;
 			state.right_chunk_index++;
-			if (state.right_chunk_index >= rsorted.radix_sorting_data.size()) {
+			if (no_more_matches || state.right_chunk_index >= rsorted.radix_sorting_data.size()) {
 				state.finished = true;
 			}
 		} else {
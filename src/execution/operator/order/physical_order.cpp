@@ -111,15 +111,20 @@ SinkCombineResultType PhysicalOrder::Combine(ExecutionContext &context, Operator
 
 class PhysicalOrderMergeTask : public ExecutorTask {
 public:
-	PhysicalOrderMergeTask(shared_ptr<Event> event_p, ClientContext &context, OrderGlobalSinkState &state)
-	    : ExecutorTask(context, std::move(event_p)), context(context), state(state) {
+	PhysicalOrderMergeTask(shared_ptr<Event> event_p, ClientContext &context, OrderGlobalSinkState &state, bool k_way)
+	    : ExecutorTask(context, std::move(event_p)), context(context), state(state), k_way(k_way) {
 	}
 
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
 		// Initialize merge sorted and iterate until done
 		auto &global_sort_state = state.global_sort_state;
-		MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
-		merge_sorter.PerformInMergeRound();
+		if (k_way) {
+			KWayMergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
+			merge_sorter.PerformKWayMerge();
+		} else {
+			MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
+			merge_sorter.PerformInMergeRound();
+		}
 		event->FinishTask();
 		return TaskExecutionResult::TASK_FINISHED;
 	}
@@ -127,15 +132,18 @@ public:
 private:
 	ClientContext &context;
 	OrderGlobalSinkState &state;
+	//! Whether to merge all sorted blocks at once, or pairs of sorted blocks
+	bool k_way;
 };
 
 class OrderMergeEvent : public BasePipelineEvent {
 public:
-	OrderMergeEvent(OrderGlobalSinkState &gstate_p, Pipeline &pipeline_p)
-	    : BasePipelineEvent(pipeline_p), gstate(gstate_p) {
+	OrderMergeEvent(OrderGlobalSinkState &gstate_p, Pipeline &pipeline_p, bool k_way_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p), k_way(k_way_p) {
 	}
 
 	OrderGlobalSinkState &gstate;
+	bool k_way;
 
 public:
 	void Schedule() override {
@@ -147,7 +155,7 @@ public:
 
 		vector<shared_ptr<Task>> merge_tasks;
 		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
-			merge_tasks.push_back(make_uniq<PhysicalOrderMergeTask>(shared_from_this(), context, gstate));
+			merge_tasks.push_back(make_uniq<PhysicalOrderMergeTask>(shared_from_this(), context, gstate, k_way));
 		}
 		SetTasks(std::move(merge_tasks));
 	}
@@ -163,6 +171,56 @@ public:
 	}
 };
 
+class PhysicalOrderSplitTask : public ExecutorTask {
+public:
+	PhysicalOrderSplitTask(shared_ptr<Event> event_p, ClientContext &context, OrderGlobalSinkState &state)
+	    : ExecutorTask(context, std::move(event_p)), context(context), state(state) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		// Compute partition boundaries of the k-way merge until all are known
+		KWayMergeSorter merge_sorter(state.global_sort_state, BufferManager::GetBufferManager(context));
+		merge_sorter.ComputeSplitters();
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ClientContext &context;
+	OrderGlobalSinkState &state;
+};
+
+class OrderSplitEvent : public BasePipelineEvent {
+public:
+	OrderSplitEvent(OrderGlobalSinkState &gstate_p, Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p) {
+	}
+
+	OrderGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		// Schedule tasks equal to the number of threads, which will each compute multiple partition boundaries
+		auto &ts = TaskScheduler::GetScheduler(context);
+		idx_t num_threads = ts.NumberOfThreads();
+
+		vector<shared_ptr<Task>> split_tasks;
+		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
+			split_tasks.push_back(make_uniq<PhysicalOrderSplitTask>(shared_from_this(), context, gstate));
+		}
+		SetTasks(std::move(split_tasks));
+	}
+
+	void FinishEvent() override {
+		// All boundaries are known: slice the sorted blocks and merge the partitions
+		gstate.global_sort_state.PrepareKWayMergePartitions();
+		auto new_event = make_shared<OrderMergeEvent>(gstate, *pipeline, true);
+		InsertEvent(std::move(new_event));
+	}
+};
+
 SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                          OperatorSinkFinalizeInput &input) const {
 	auto &state = input.global_state.Cast<OrderGlobalSinkState>();
@@ -183,11 +241,41 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 	return SinkFinalizeType::READY;
 }
 
+//! The number of sorted blocks that can be merged at once
+static idx_t MaxMergeWidth(ClientContext &context, GlobalSortState &global_sort_state) {
+	auto &sorted_blocks = global_sort_state.sorted_blocks;
+	if (!global_sort_state.external) {
+		// All data is in memory already
+		return sorted_blocks.size();
+	}
+	idx_t block_size = 0;
+	for (auto &sb : sorted_blocks) {
+		block_size = MaxValue(block_size, sb->SizeInBytes() / MaxValue<idx_t>(sb->radix_sorting_data.size(), 1));
+	}
+	// Every merge task pins a block of each sorted block it reads from, and the block it writes. The tasks that compute
+	// the partition boundaries run before the merge tasks, and pin at most one block of each sorted block
+	// Half of the memory is left to the rest of the query
+	const idx_t num_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
+	const idx_t available_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory() / 2;
+	const idx_t pinned_blocks = available_memory / MaxValue<idx_t>(num_threads * block_size, 1);
+	return MaxValue<idx_t>(pinned_blocks, 3) - 1;
+}
+
 void PhysicalOrder::ScheduleMergeTasks(Pipeline &pipeline, Event &event, OrderGlobalSinkState &state) {
-	// Initialize global sort state for a round of merging
-	state.global_sort_state.InitializeMergeRound();
-	auto new_event = make_shared<OrderMergeEvent>(state, pipeline);
-	event.InsertEvent(std::move(new_event));
+	auto &global_sort_state = state.global_sort_state;
+	// Merge all sorted blocks at once if they can all be read at the same time, otherwise do a round of merging
+	const bool k_way =
+	    global_sort_state.sorted_blocks.size() <= MaxMergeWidth(pipeline.GetClientContext(), global_sort_state);
+	if (k_way) {
+		// Compute the partition boundaries first
+		global_sort_state.InitializeKWayMerge();
+		auto new_event = make_shared<OrderSplitEvent>(state, pipeline);
+		event.InsertEvent(std::move(new_event));
+	} else {
+		global_sort_state.InitializeMergeRound();
+		auto new_event = make_shared<OrderMergeEvent>(state, pipeline, false);
+		event.InsertEvent(std::move(new_event));
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -111,4 +111,17 @@ string PhysicalProjection::ParamsToString() const {
 	return extra_info;
 }
 
+bool PhysicalProjection::Equals(const PhysicalOperator &other_p) const {
+	if (type != other_p.type) {
+		return false;
+	}
+	auto &other = other_p.Cast<PhysicalProjection>();
+	for (auto &expr : select_list) {
+		if (expr->IsVolatile()) {
+			return false;
+		}
+	}
+	return Expression::ListEquals(select_list, other.select_list);
+}
+
 } // namespace duckdb
@@ -41,6 +41,28 @@ public:
 	idx_t MaxThreads() override {
 		return max_threads;
 	}
+
+	//! Returns the filters of the scan, combined with the filters that were pushed into the scan at runtime.
+	//! The local states of a scan are only created once the operators the scan depends on (e.g., the build side of a
+	//! hash join) have finished, so the dynamic filters are complete at this point.
+	optional_ptr<TableFilterSet> GetTableFilters(const PhysicalTableScan &op) {
+		if (!op.dynamic_filters) {
+			return op.table_filters.get();
+		}
+		lock_guard<mutex> guard(lock);
+		if (!table_filters_initialized) {
+			if (op.dynamic_filters->HasFilters()) {
+				table_filters = op.dynamic_filters->GetFinalTableFilters(op.table_filters.get());
+			}
+			table_filters_initialized = true;
+		}
+		return table_filters ? table_filters.get() : op.table_filters.get();
+	}
+
+private:
+	mutex lock;
+	bool table_filters_initialized = false;
+	unique_ptr<TableFilterSet> table_filters;
 };
 
 class TableScanLocalSourceState : public LocalSourceState {
@@ -48,7 +70,8 @@ public:
 	TableScanLocalSourceState(ExecutionContext &context, TableScanGlobalSourceState &gstate,
 	                          const PhysicalTableScan &op) {
 		if (op.function.init_local) {
-			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids, op.table_filters.get());
+			TableFunctionInitInput input(op.bind_data.get(), op.column_ids, op.projection_ids,
+			                             gstate.GetTableFilters(op));
 			local_state = op.function.init_local(context, input, gstate.global_state.get());
 		}
 	}
@@ -160,12 +183,19 @@ bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	if (function.function != other.function.function) {
 		return false;
 	}
-	if (column_ids != other.column_ids) {
+	if (column_ids != other.column_ids || projection_ids != other.projection_ids) {
 		return false;
 	}
 	if (!FunctionData::Equals(bind_data.get(), other.bind_data.get())) {
 		return false;
 	}
+	if (!TableFilterSet::Equals(table_filters.get(), other.table_filters.get())) {
+		return false;
+	}
+	if (dynamic_filters || other.dynamic_filters) {
+		// the filters are only known at runtime
+		return false;
+	}
 	return true;
 }
 
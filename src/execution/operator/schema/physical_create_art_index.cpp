@@ -3,12 +3,20 @@
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/execution/operator/schema/physical_create_index.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/index.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 
 namespace duckdb {
@@ -16,10 +24,10 @@ namespace duckdb {
 PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table_p,
                                                const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
                                                vector<unique_ptr<Expression>> unbound_expressions,
-                                               idx_t estimated_cardinality, const bool sorted)
+                                               idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
-      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)), unbound_expressions(std::move(unbound_expressions)),
-      sorted(sorted) {
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
 
 	// convert virtual column ids to storage column ids
 	for (auto &column_id : column_ids) {
@@ -31,30 +39,251 @@ PhysicalCreateARTIndex::PhysicalCreateARTIndex(LogicalOperator &op, TableCatalog
 // Sink
 //===--------------------------------------------------------------------===//
 
+//! The keys (and their row IDs) collected by a thread. They are stored in a buffer-managed collection, so that they
+//! can be offloaded to disk while the keys of other threads are partitioned or the partitions are constructed
+struct ARTKeyCollection {
+	//! The maximum number of sampled keys
+	static constexpr idx_t SAMPLE_CAPACITY = 1024;
+
+	explicit ARTKeyCollection(ClientContext &context)
+	    : buffer_manager(BufferManager::GetBufferManager(context)),
+	      keys(make_uniq<ColumnDataCollection>(buffer_manager, types)) {
+		keys->InitializeAppend(append_state);
+	}
+
+	BufferManager &buffer_manager;
+	//! The types of the collection: the keys (as blobs), and their row IDs
+	const vector<LogicalType> types = {LogicalType::BLOB, LogicalType::ROW_TYPE};
+	unique_ptr<ColumnDataCollection> keys;
+	ColumnDataAppendState append_state;
+	//! The keys of each partition, after partitioning
+	vector<unique_ptr<ColumnDataCollection>> partitions;
+
+	//! The smallest and the largest key
+	string min_key;
+	string max_key;
+	//! Every sample_stride-th key, the stride doubles whenever the sample is full
+	vector<string> sample;
+	idx_t sample_stride = 1;
+	idx_t sample_skip = 0;
+
+public:
+	void AddSample(const ARTKey &key) {
+		if (++sample_skip < sample_stride) {
+			return;
+		}
+		sample_skip = 0;
+		sample.emplace_back(const_char_ptr_cast(key.data), key.len);
+		if (sample.size() < SAMPLE_CAPACITY) {
+			return;
+		}
+		// keep every other sampled key
+		for (idx_t i = 0; i < sample.size() / 2; i++) {
+			sample[i] = std::move(sample[2 * i + 1]);
+		}
+		sample.resize(sample.size() / 2);
+		sample_stride *= 2;
+	}
+};
+
+//! Widens a key range by another key range
+static void AddKeyRange(string &min_key, string &max_key, const string &min, const string &max) {
+	if (min_key.empty() || min < min_key) {
+		min_key = min;
+	}
+	if (max_key.empty() || max > max_key) {
+		max_key = max;
+	}
+}
+
+//! The memory that sorting and constructing the ART of a number of keys takes, in addition to the keys themselves
+static idx_t ConstructionSize(idx_t count, idx_t key_size) {
+	return key_size + count * (sizeof(pair<ARTKey, row_t>) + sizeof(ARTKey) + sizeof(row_t));
+}
+
 class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
+	explicit CreateARTIndexGlobalSinkState(ClientContext &context)
+	    : temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)) {
+	}
+
 	//! Global index to be added to the table
 	unique_ptr<Index> global_index;
+	//! The memory of constructing all partitions at once, and of constructing the largest one
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+	idx_t key_count = 0;
+	idx_t key_size = 0;
+
+	mutex lock;
+	//! The keys collected by all threads
+	vector<unique_ptr<ARTKeyCollection>> collections;
+	//! The smallest and the largest key
+	string min_key;
+	string max_key;
+	//! The length of the common prefix of all keys, the keys are partitioned by their byte at this depth
+	idx_t partition_depth = 0;
+	//! The partition of each key byte at the partition depth. The splitters of the partitions are chosen from the
+	//! sampled keys, such that the partitions hold a similar number of keys
+	array<idx_t, 256> byte_partitions;
+	idx_t partition_count = 0;
+	//! The ARTs constructed from the keys of each partition, one per key byte
+	vector<vector<pair<data_t, unique_ptr<ART>>>> partition_arts;
+	//! The key bytes of the non-empty subtrees below the common prefix, and their ARTs
+	vector<data_t> partition_bytes;
+	vector<unique_ptr<ART>> partitions;
+	//! The buffer ID offsets of the nodes of each subtree in the global index
+	vector<ARTFlags> merge_flags;
+
+public:
+	//! Chooses the splitters of the partitions from the sampled keys of all threads
+	void ChoosePartitions(idx_t max_partitions) {
+		// weigh the sampled keys by their stride
+		array<idx_t, 256> byte_weights;
+		byte_weights.fill(0);
+		idx_t total_weight = 0;
+		for (auto &collection : collections) {
+			for (auto &key : collection->sample) {
+				D_ASSERT(key.size() > partition_depth);
+				byte_weights[data_t(key[partition_depth])] += collection->sample_stride;
+				total_weight += collection->sample_stride;
+			}
+		}
+		auto partition_weight = MaxValue<idx_t>(total_weight / max_partitions, 1);
+		idx_t largest_weight = 0;
+		idx_t weight = 0;
+		partition_count = 0;
+		for (idx_t key_byte = 0; key_byte < 256; key_byte++) {
+			if (weight >= partition_weight) {
+				largest_weight = MaxValue(largest_weight, weight);
+				partition_count++;
+				weight = 0;
+			}
+			byte_partitions[key_byte] = partition_count;
+			weight += byte_weights[key_byte];
+		}
+		largest_weight = MaxValue(largest_weight, weight);
+		partition_count++;
+		partition_arts.resize(partition_count);
+
+		// the partitions are constructed from memory, the largest one must fit at least
+		auto largest_count = total_weight ? key_count * largest_weight / total_weight : key_count;
+		auto largest_size = total_weight ? key_size * largest_weight / total_weight : key_size;
+		temporary_memory_state->SetMinimumReservation(ConstructionSize(largest_count, largest_size));
+	}
+
+	//! Scatters the keys of a collection into their partitions
+	void PartitionKeys(idx_t collection_idx) {
+		auto &collection = *collections[collection_idx];
+		for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+			collection.partitions.push_back(
+			    make_uniq<ColumnDataCollection>(collection.buffer_manager, collection.types));
+		}
+
+		vector<SelectionVector> partition_sels(partition_count);
+		vector<idx_t> partition_counts(partition_count);
+		DataChunk partition_chunk;
+		partition_chunk.InitializeEmpty(collection.types);
+		for (auto &chunk : collection.keys->Chunks()) {
+			std::fill(partition_counts.begin(), partition_counts.end(), 0);
+			auto keys = FlatVector::GetData<string_t>(chunk.data[0]);
+			for (idx_t i = 0; i < chunk.size(); i++) {
+				D_ASSERT(keys[i].GetSize() > partition_depth);
+				auto partition_idx = byte_partitions[data_t(keys[i].GetData()[partition_depth])];
+				if (!partition_sels[partition_idx].data()) {
+					partition_sels[partition_idx].Initialize(STANDARD_VECTOR_SIZE);
+				}
+				partition_sels[partition_idx].set_index(partition_counts[partition_idx]++, i);
+			}
+			for (idx_t partition_idx = 0; partition_idx < partition_count; partition_idx++) {
+				if (partition_counts[partition_idx] == 0) {
+					continue;
+				}
+				partition_chunk.Slice(chunk, partition_sels[partition_idx], partition_counts[partition_idx]);
+				collection.partitions[partition_idx]->Append(partition_chunk);
+			}
+		}
+		collection.keys.reset();
+	}
+
+	//! Sorts the keys of a partition, and constructs the subtree below each of their key bytes
+	void ConstructPartition(const PhysicalCreateARTIndex &op, idx_t partition_idx) {
+		ArenaAllocator arena(BufferAllocator::Get(op.table.GetStorage().db));
+		vector<pair<ARTKey, row_t>> entries;
+		for (auto &collection : collections) {
+			auto &partition = collection->partitions[partition_idx];
+			for (auto &chunk : partition->Chunks()) {
+				auto keys = FlatVector::GetData<string_t>(chunk.data[0]);
+				auto row_ids = FlatVector::GetData<row_t>(chunk.data[1]);
+				for (idx_t i = 0; i < chunk.size(); i++) {
+					auto len = UnsafeNumericCast<uint32_t>(keys[i].GetSize());
+					ARTKey key(arena, len);
+					memcpy(key.data, keys[i].GetData(), len);
+					entries.emplace_back(key, row_ids[i]);
+				}
+			}
+			partition.reset();
+		}
+		std::sort(entries.begin(), entries.end(),
+		          [](const pair<ARTKey, row_t> &lhs, const pair<ARTKey, row_t> &rhs) { return rhs.first > lhs.first; });
+
+		vector<ARTKey> keys;
+		vector<row_t> row_ids;
+		keys.reserve(entries.size());
+		row_ids.reserve(entries.size());
+		for (auto &entry : entries) {
+			keys.push_back(entry.first);
+			row_ids.push_back(entry.second);
+		}
+		vector<pair<ARTKey, row_t>>().swap(entries);
+
+		// the keys of each key byte form a disjoint subtree
+		auto &arts = partition_arts[partition_idx];
+		idx_t start = 0;
+		while (start < keys.size()) {
+			auto key_byte = keys[start].data[partition_depth];
+			idx_t end = start + 1;
+			while (end < keys.size() && keys[end].data[partition_depth] == key_byte) {
+				end++;
+			}
+			auto begin = keys.begin() + NumericCast<int64_t>(start);
+			vector<ARTKey> byte_keys(begin, begin + NumericCast<int64_t>(end - start));
+			auto art = op.CreateART();
+			if (!art->ConstructFromSorted(byte_keys.size(), byte_keys, row_ids.data() + start, partition_depth + 1)) {
+				throw ConstraintException("Data contains duplicates on indexed column(s)");
+			}
+			arts.emplace_back(key_byte, std::move(art));
+			start = end;
+		}
+	}
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
 public:
-	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
+	explicit CreateARTIndexLocalSinkState(ClientContext &context)
+	    : collection(make_uniq<ARTKeyCollection>(context)), arena(BufferAllocator::Get(context)),
+	      keys(STANDARD_VECTOR_SIZE) {};
 
-	unique_ptr<Index> local_index;
-	ArenaAllocator arena_allocator;
+	unique_ptr<ARTKeyCollection> collection;
+	//! The keys of the current chunk
+	ArenaAllocator arena;
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+	//! The keys (as blobs) and the row IDs of the current chunk
+	DataChunk collection_chunk;
 };
 
+unique_ptr<ART> PhysicalCreateARTIndex::CreateART() const {
+	auto &storage = table.GetStorage();
+	return make_uniq<ART>(info->index_name, info->constraint_type, storage_ids, TableIOManager::Get(storage),
+	                      unbound_expressions, storage.db);
+}
+
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
-	auto state = make_uniq<CreateARTIndexGlobalSinkState>();
+	auto state = make_uniq<CreateARTIndexGlobalSinkState>(context);
 
 	// create the global index
-	auto &storage = table.GetStorage();
-	state->global_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                     TableIOManager::Get(storage), unbound_expressions, storage.db);
+	state->global_index = CreateART();
 
 	return (std::move(state));
 }
@@ -62,14 +291,12 @@ unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientCon
 unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionContext &context) const {
 	auto state = make_uniq<CreateARTIndexLocalSinkState>(context.client);
 
-	// create the local index
-
-	auto &storage = table.GetStorage();
-	state->local_index = make_uniq<ART>(info->index_name, info->constraint_type, storage_ids,
-	                                    TableIOManager::Get(storage), unbound_expressions, storage.db);
-
-	state->keys = vector<ARTKey>(STANDARD_VECTOR_SIZE);
-	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
+	vector<LogicalType> key_types;
+	for (auto &expr : unbound_expressions) {
+		key_types.push_back(expr->return_type);
+	}
+	state->key_chunk.Initialize(Allocator::Get(context.client), key_types);
+	state->collection_chunk.Initialize(Allocator::Get(context.client), state->collection->types);
 
 	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
 		state->key_column_ids.push_back(i);
@@ -77,117 +304,227 @@ unique_ptr<LocalSinkState> PhysicalCreateARTIndex::GetLocalSinkState(ExecutionCo
 	return std::move(state);
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto count = l_state.key_chunk.size();
+SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSinkInput &input) const {
 
-	// get the corresponding row IDs
-	row_identifiers.Flatten(count);
-	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+	D_ASSERT(chunk.ColumnCount() >= 2);
 
-	// insert the row IDs
-	auto &art = l_state.local_index->Cast<ART>();
+	// generate the keys for the given input
+	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto &collection = *l_state.collection;
+	l_state.arena.Reset();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+	ART::GenerateKeys(l_state.arena, l_state.key_chunk, l_state.keys);
+
+	// collect the keys and their corresponding row IDs, the collection copies the keys
+	auto count = chunk.size();
+	auto &collection_chunk = l_state.collection_chunk;
+	collection_chunk.Reset();
+	auto key_data = FlatVector::GetData<string_t>(collection_chunk.data[0]);
+	idx_t min_idx = 0;
+	idx_t max_idx = 0;
 	for (idx_t i = 0; i < count; i++) {
-		if (!art.Insert(art.tree, l_state.keys[i], 0, row_ids[i])) {
-			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		auto &key = l_state.keys[i];
+		if (l_state.keys[min_idx] > key) {
+			min_idx = i;
+		}
+		if (key > l_state.keys[max_idx]) {
+			max_idx = i;
 		}
+		key_data[i] = string_t(const_char_ptr_cast(key.data), key.len);
+		collection.AddSample(key);
+	}
+	collection_chunk.data[1].Reference(chunk.data[chunk.ColumnCount() - 1]);
+	collection_chunk.SetCardinality(count);
+	collection.keys->Append(collection.append_state, collection_chunk);
+
+	if (count > 0) {
+		auto &min_key = l_state.keys[min_idx];
+		auto &max_key = l_state.keys[max_idx];
+		AddKeyRange(collection.min_key, collection.max_key, string(const_char_ptr_cast(min_key.data), min_key.len),
+		            string(const_char_ptr_cast(max_key.data), max_key.len));
 	}
-
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
-
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
-	auto &l_index = l_state.local_index;
+SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
+                                                      OperatorSinkCombineInput &input) const {
 
-	// create an ART from the chunk
-	auto art =
-	    make_uniq<ART>(info->index_name, l_index->index_constraint_type, l_index->column_ids, l_index->table_io_manager,
-	                   l_index->unbound_expressions, storage.db, l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto &collection = *lstate.collection;
+	if (collection.keys->Count() == 0) {
+		return SinkCombineResultType::FINISHED;
 	}
 
-	// merge into the local ART
-	if (!l_index->MergeIndexes(*art)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
-	}
+	lock_guard<mutex> guard(gstate.lock);
+	AddKeyRange(gstate.min_key, gstate.max_key, collection.min_key, collection.max_key);
+	// reserve the memory of constructing the index in memory, so that other operators give way to it. The collected
+	// keys can be offloaded to disk if it does not fit
+	gstate.key_count += collection.keys->Count();
+	gstate.key_size += collection.keys->SizeInBytes();
+	gstate.temporary_memory_state->SetRemainingSize(context.client,
+	                                                ConstructionSize(gstate.key_count, gstate.key_size));
+	gstate.collections.push_back(std::move(lstate.collection));
 
-	return SinkResultType::NEED_MORE_INPUT;
+	return SinkCombineResultType::FINISHED;
 }
 
-SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
-                                            OperatorSinkInput &input) const {
+enum class ARTBuildPhase : uint8_t { PARTITION, CONSTRUCT, MERGE };
 
-	D_ASSERT(chunk.ColumnCount() >= 2);
+class CreateARTIndexTask : public ExecutorTask {
+public:
+	CreateARTIndexTask(shared_ptr<Event> event_p, ClientContext &context, const PhysicalCreateARTIndex &op,
+	                   CreateARTIndexGlobalSinkState &gstate, ARTBuildPhase phase, idx_t task_idx)
+	    : ExecutorTask(context, std::move(event_p)), op(op), gstate(gstate), phase(phase), task_idx(task_idx) {
+	}
 
-	// generate the keys for the given input
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
-	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		switch (phase) {
+		case ARTBuildPhase::PARTITION:
+			gstate.PartitionKeys(task_idx);
+			break;
+		case ARTBuildPhase::CONSTRUCT:
+			gstate.ConstructPartition(op, task_idx);
+			break;
+		case ARTBuildPhase::MERGE:
+			gstate.partitions[task_idx]->PreparePartitionMerge(gstate.merge_flags[task_idx]);
+			break;
+		}
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+	ARTBuildPhase phase;
+	idx_t task_idx;
+};
 
-	// insert the keys and their corresponding row IDs
-	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
-	if (sorted) {
-		return SinkSorted(row_identifiers, input);
+//! Runs one phase of the parallel index construction: partitioning the keys of each collection, constructing the
+//! ARTs of each partition, and preparing the subtrees for their merge into the global index
+class CreateARTIndexEvent : public BasePipelineEvent {
+public:
+	CreateARTIndexEvent(const PhysicalCreateARTIndex &op_p, CreateARTIndexGlobalSinkState &gstate_p,
+	                    Pipeline &pipeline_p, ARTBuildPhase phase_p)
+	    : BasePipelineEvent(pipeline_p), op(op_p), gstate(gstate_p), phase(phase_p) {
 	}
-	return SinkUnsorted(row_identifiers, input);
-}
 
-SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
-                                                      OperatorSinkCombineInput &input) const {
+	const PhysicalCreateARTIndex &op;
+	CreateARTIndexGlobalSinkState &gstate;
+	ARTBuildPhase phase;
 
-	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
-	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		idx_t task_count;
+		switch (phase) {
+		case ARTBuildPhase::PARTITION:
+			task_count = gstate.collections.size();
+			break;
+		case ARTBuildPhase::CONSTRUCT:
+			task_count = gstate.partition_count;
+			break;
+		default:
+			task_count = gstate.partitions.size();
+			break;
+		}
 
-	// merge the local index into the global index
-	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+		vector<shared_ptr<Task>> tasks;
+		for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+			tasks.push_back(make_uniq<CreateARTIndexTask>(shared_from_this(), context, op, gstate, phase, task_idx));
+		}
+		SetTasks(std::move(tasks));
 	}
 
-	return SinkCombineResultType::FINISHED;
-}
+	void FinishEvent() override {
+		switch (phase) {
+		case ARTBuildPhase::PARTITION: {
+			auto next_event = make_shared<CreateARTIndexEvent>(op, gstate, *pipeline, ARTBuildPhase::CONSTRUCT);
+			InsertEvent(std::move(next_event));
+			break;
+		}
+		case ARTBuildPhase::CONSTRUCT: {
+			// the partitions cover ascending ranges of key bytes
+			for (auto &arts : gstate.partition_arts) {
+				for (auto &art : arts) {
+					gstate.partition_bytes.push_back(art.first);
+					gstate.partitions.push_back(std::move(art.second));
+				}
+			}
+			gstate.partition_arts.clear();
+			gstate.collections.clear();
+			gstate.merge_flags = ART::InitializePartitionMerge(gstate.partitions);
+			auto next_event = make_shared<CreateARTIndexEvent>(op, gstate, *pipeline, ARTBuildPhase::MERGE);
+			InsertEvent(std::move(next_event));
+			break;
+		}
+		case ARTBuildPhase::MERGE: {
+			// the keys of the subtrees are disjoint: they become the children of the root
+			auto &art = gstate.global_index->Cast<ART>();
+			ARTKey prefix_key(data_ptr_cast(&gstate.min_key[0]), UnsafeNumericCast<uint32_t>(gstate.min_key.size()));
+			art.MergePartitions(gstate.partitions, gstate.partition_bytes, prefix_key, gstate.partition_depth);
+			gstate.partitions.clear();
+			gstate.temporary_memory_state->SetRemainingSize(pipeline->GetClientContext(), 0);
+			op.AddIndex(pipeline->GetClientContext(), gstate);
+			break;
+		}
+		}
+	}
+};
 
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 
-	// here, we set the resulting global index as the newly created index of the table
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
-
-	// vacuum excess memory and verify
-	state.global_index->Vacuum();
-	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
-
-	auto &storage = table.GetStorage();
-	if (!storage.IsRoot()) {
-		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	if (state.collections.empty()) {
+		AddIndex(context, state);
+		return SinkFinalizeType::READY;
 	}
 
-	auto &schema = table.schema;
-	info->column_ids = storage_ids;
-	auto index_entry = schema.CreateIndex(context, *info, table).get();
-	if (!index_entry) {
-		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
-		// index already exists, but error ignored because of IF NOT EXISTS
+	// the keys are partitioned by the first byte in which they differ
+	auto &min_key = state.min_key;
+	auto &max_key = state.max_key;
+	idx_t depth = 0;
+	while (depth < min_key.size() && depth < max_key.size() && min_key[depth] == max_key[depth]) {
+		depth++;
+	}
+	if (depth < min_key.size()) {
+		state.partition_depth = depth;
+		state.ChoosePartitions(MaxValue<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads() * 4, 1));
+		event.InsertEvent(make_shared<CreateARTIndexEvent>(*this, state, pipeline, ARTBuildPhase::PARTITION));
 		return SinkFinalizeType::READY;
 	}
-	auto &index = index_entry->Cast<DuckIndexEntry>();
-	index.initial_index_size = state.global_index->GetInMemorySize();
 
-	index.info = make_shared<IndexDataTableInfo>(storage.info, index.name);
-	for (auto &parsed_expr : info->parsed_expressions) {
-		index.parsed_expressions.push_back(parsed_expr->Copy());
+	// all keys are equal: they form a single leaf
+	vector<ARTKey> keys;
+	vector<row_t> row_ids;
+	ARTKey key(data_ptr_cast(&min_key[0]), UnsafeNumericCast<uint32_t>(min_key.size()));
+	for (auto &collection : state.collections) {
+		for (auto &chunk : collection->keys->Chunks()) {
+			auto chunk_row_ids = FlatVector::GetData<row_t>(chunk.data[1]);
+			keys.insert(keys.end(), chunk.size(), key);
+			row_ids.insert(row_ids.end(), chunk_row_ids, chunk_row_ids + chunk.size());
+		}
 	}
-
-	// add index to storage
-	storage.info->indexes.AddIndex(std::move(state.global_index));
+	auto &art = state.global_index->Cast<ART>();
+	if (!art.ConstructFromSorted(keys.size(), keys, row_ids.data(), 0)) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+	state.collections.clear();
+	state.temporary_memory_state->SetRemainingSize(context, 0);
+	AddIndex(context, state);
 	return SinkFinalizeType::READY;
 }
 
+void PhysicalCreateARTIndex::AddIndex(ClientContext &context, GlobalSinkState &gstate) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = gstate.Cast<CreateARTIndexGlobalSinkState>();
+	PhysicalCreateIndex::AddIndex(context, table, *info, storage_ids, std::move(state.global_index));
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,163 @@
+#include "duckdb/execution/operator/schema/physical_create_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/index.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateIndex::PhysicalCreateIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                         const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
+                                         vector<unique_ptr<Expression>> unbound_expressions, IndexType &index_type,
+                                         idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)), index_type(index_type) {
+
+	// convert virtual column ids to storage column ids
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+unique_ptr<Index> PhysicalCreateIndex::CreateIndex() const {
+	auto &storage = table.GetStorage();
+	IndexStorageInfo storage_info;
+	CreateIndexInput input(TableIOManager::Get(storage), storage.db, info->constraint_type, info->index_name,
+	                       storage_ids, unbound_expressions, storage_info, info->options);
+	return index_type.create_instance(input);
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateIndexGlobalSinkState : public GlobalSinkState {
+public:
+	//! Global index to be added to the table
+	unique_ptr<Index> global_index;
+	mutex lock;
+};
+
+class CreateIndexLocalSinkState : public LocalSinkState {
+public:
+	//! The index of the keys of this thread
+	unique_ptr<Index> local_index;
+	DataChunk key_chunk;
+	vector<column_t> key_column_ids;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateIndex::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<CreateIndexGlobalSinkState>();
+
+	// create the global index
+	state->global_index = CreateIndex();
+
+	return (std::move(state));
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateIndex::GetLocalSinkState(ExecutionContext &context) const {
+	auto state = make_uniq<CreateIndexLocalSinkState>();
+	state->local_index = CreateIndex();
+
+	vector<LogicalType> key_types;
+	for (auto &expr : unbound_expressions) {
+		key_types.push_back(expr->return_type);
+	}
+	state->key_chunk.Initialize(Allocator::Get(context.client), key_types);
+
+	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
+		state->key_column_ids.push_back(i);
+	}
+	return std::move(state);
+}
+
+SinkResultType PhysicalCreateIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                         OperatorSinkInput &input) const {
+
+	D_ASSERT(chunk.ColumnCount() >= 2);
+
+	// insert the keys and their row IDs into the index of this thread
+	auto &l_state = input.local_state.Cast<CreateIndexLocalSinkState>();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
+
+	IndexLock lock;
+	l_state.local_index->InitializeLock(lock);
+	auto error = l_state.local_index->Insert(lock, l_state.key_chunk, row_identifiers);
+	if (error.HasError()) {
+		error.Throw();
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalCreateIndex::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+
+	auto &gstate = input.global_state.Cast<CreateIndexGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<CreateIndexLocalSinkState>();
+
+	// merge the index of this thread into the global index
+	lock_guard<mutex> guard(gstate.lock);
+	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
+		throw InternalException("Failed to merge the index of a thread into the global index");
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalCreateIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                               OperatorSinkFinalizeInput &input) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = input.global_state.Cast<CreateIndexGlobalSinkState>();
+	AddIndex(context, table, *info, storage_ids, std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+void PhysicalCreateIndex::AddIndex(ClientContext &context, DuckTableEntry &table, CreateIndexInfo &info,
+                                   const vector<column_t> &storage_ids, unique_ptr<Index> global_index) {
+
+	// vacuum excess memory and verify
+	global_index->Vacuum();
+	D_ASSERT(!global_index->VerifyAndToString(true).empty());
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info.column_ids = storage_ids;
+	auto index_entry = schema.CreateIndex(context, info, table).get();
+	if (!index_entry) {
+		D_ASSERT(info.on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
+		// index already exists, but error ignored because of IF NOT EXISTS
+		return;
+	}
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = global_index->GetInMemorySize();
+
+	index.info = make_shared<IndexDataTableInfo>(storage.info, index.name);
+	for (auto &parsed_expr : info.parsed_expressions) {
+		index.parsed_expressions.push_back(parsed_expr->Copy());
+	}
+
+	// add index to storage
+	storage.info->indexes.AddIndex(std::move(global_index));
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
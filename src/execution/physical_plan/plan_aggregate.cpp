@@ -2,15 +2,22 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
@@ -149,15 +156,133 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Returns the column of the input that rows with equal values of a projected expression are consecutive in, if any.
+//! Besides references, these are the (injective) compression functions of compressed materialization
+static optional_idx GetGroupedColumn(const Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index;
+	}
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return optional_idx();
+	}
+	auto &function = expr.Cast<BoundFunctionExpression>();
+	if (!StringUtil::StartsWith(function.function.name, "__internal_compress") &&
+	    !StringUtil::StartsWith(function.function.name, "__internal_decompress")) {
+		return optional_idx();
+	}
+	return GetGroupedColumn(*function.children[0]);
+}
+
+//! Maps ordered columns of the input of an operator to its output, stopping at the first column that is projected out
+static vector<idx_t> MapOrderedColumns(const vector<idx_t> &input_columns, const vector<idx_t> &projection_map) {
+	if (projection_map.empty()) {
+		return input_columns;
+	}
+	vector<idx_t> result;
+	for (auto &column : input_columns) {
+		auto entry = std::find(projection_map.begin(), projection_map.end(), column);
+		if (entry == projection_map.end()) {
+			break;
+		}
+		result.push_back(NumericCast<idx_t>(entry - projection_map.begin()));
+	}
+	return result;
+}
+
+//! Returns the columns of the output of a (resolved) logical operator that its rows are known to be grouped by, in
+//! order: the rows with equal values in any prefix of these columns are consecutive
+static vector<idx_t> GetOrderedColumns(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_TOP_N: {
+		auto &orders = op.type == LogicalOperatorType::LOGICAL_ORDER_BY ? op.Cast<LogicalOrder>().orders
+		                                                                 : op.Cast<LogicalTopN>().orders;
+		vector<idx_t> input_columns;
+		for (auto &order : orders) {
+			if (order.expression->type != ExpressionType::BOUND_REF) {
+				break;
+			}
+			input_columns.push_back(order.expression->Cast<BoundReferenceExpression>().index);
+		}
+		if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+			return input_columns;
+		}
+		return MapOrderedColumns(input_columns, op.Cast<LogicalOrder>().projections);
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto input_columns = GetOrderedColumns(*op.children[0]);
+		vector<idx_t> result;
+		for (auto &column : input_columns) {
+			idx_t expr_idx;
+			for (expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
+				auto grouped_column = GetGroupedColumn(*op.expressions[expr_idx]);
+				if (grouped_column.IsValid() && grouped_column.GetIndex() == column) {
+					break;
+				}
+			}
+			if (expr_idx == op.expressions.size()) {
+				break;
+			}
+			result.push_back(expr_idx);
+		}
+		return result;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		return MapOrderedColumns(GetOrderedColumns(*op.children[0]), op.Cast<LogicalFilter>().projection_map);
+	case LogicalOperatorType::LOGICAL_LIMIT:
+		return GetOrderedColumns(*op.children[0]);
+	default:
+		return vector<idx_t>();
+	}
+}
+
+//! Whether the input of an aggregate is ordered such that rows with equal groups are consecutive
+static bool CanUseStreamingAggregate(ClientContext &context, LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (context.PolicyCheckingEnabled()) {
+		// the streaming aggregate does not report the groups to the policy checker
+		return false;
+	}
+	// the streaming aggregate runs single-threaded: inputs that could keep all threads busy are aggregated in parallel
+	auto threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	if (threads > 1 && op.children[0]->EstimateCardinality(context) > threads * Storage::ROW_GROUP_SIZE) {
+		return false;
+	}
+	auto ordered_columns = GetOrderedColumns(*op.children[0]);
+	if (ordered_columns.size() < op.groups.size()) {
+		return false;
+	}
+	// the groups must be exactly the first ordered columns
+	ordered_columns.resize(op.groups.size());
+	for (auto &group : op.groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto index = group->Cast<BoundReferenceExpression>().index;
+		if (std::find(ordered_columns.begin(), ordered_columns.end(), index) == ordered_columns.end()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	const auto input_is_ordered = CanUseStreamingAggregate(context, op);
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
 
-	if (op.groups.empty() && op.grouping_sets.size() <= 1) {
+	if (input_is_ordered && PhysicalStreamingAggregate::CanStreamAggregates(op.expressions)) {
+		// the groups arrive one after the other: aggregate them without a hash table
+		groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+		    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+	} else if (op.groups.empty() && op.grouping_sets.size() <= 1) {
 		// no groups, check if we can use a simple aggregation
 		// special case: aggregate entire columns together
 		bool use_simple_aggregation = true;
@@ -2,8 +2,10 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -43,8 +45,8 @@ bool ExtractNumericValue(Value val, int64_t &result) {
 }
 
 void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &join_state) {
-	// we only do this optimization for inner joins
-	if (op.join_type != JoinType::INNER) {
+	// we only do this optimization for inner joins, and for joins that only test whether the key exists
+	if (!PerfectHashJoinExecutor::SupportsJoinType(op.join_type)) {
 		return;
 	}
 	// with one condition
@@ -98,14 +100,14 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 
 	// Fill join_stats for invisible join
 	auto &stats_probe = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
-	}
+	const bool probe_has_min_max = NumericStats::HasMinMax(stats_probe);
 
 	// The max size our build must have to run the perfect HJ
 	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
+	if (probe_has_min_max) {
+		join_state.probe_min = NumericStats::Min(stats_probe);
+		join_state.probe_max = NumericStats::Max(stats_probe);
+	}
 	join_state.build_min = NumericStats::Min(stats_build);
 	join_state.build_max = NumericStats::Max(stats_build);
 	join_state.estimated_cardinality = op.estimated_cardinality;
@@ -113,7 +115,7 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (join_state.build_range > MAX_BUILD_SIZE) {
 		return;
 	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
+	if (probe_has_min_max && NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
 	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
 		join_state.is_probe_in_domain = true;
 	}
@@ -121,6 +123,191 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	return;
 }
 
+//! Finds the table scan that produces column "column_index" of "op" (unchanged), and sets "column_index" to the index
+//! of the column in the column ids of the scan
+static optional_ptr<PhysicalTableScan> FindProbeTableScan(PhysicalOperator &op, idx_t &column_index) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" || !scan.function.filter_pushdown) {
+			return nullptr;
+		}
+		if (!scan.projection_ids.empty()) {
+			column_index = scan.projection_ids[column_index];
+		}
+		if (scan.column_ids[column_index] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		return &scan;
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindProbeTableScan(*op.children[0], column_index);
+	case PhysicalOperatorType::PROJECTION: {
+		auto &projection = op.Cast<PhysicalProjection>();
+		auto &expr = *projection.select_list[column_index];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return nullptr;
+		}
+		column_index = expr.Cast<BoundReferenceExpression>().index;
+		return FindProbeTableScan(*op.children[0], column_index);
+	}
+	case PhysicalOperatorType::HASH_JOIN: {
+		// the left (probe-side) columns come first in the output of these joins
+		auto &join = op.Cast<PhysicalHashJoin>();
+		switch (join.join_type) {
+		case JoinType::INNER:
+		case JoinType::LEFT:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+		case JoinType::MARK:
+		case JoinType::SINGLE:
+			break;
+		default:
+			return nullptr;
+		}
+		if (column_index >= join.children[0]->types.size()) {
+			return nullptr;
+		}
+		return FindProbeTableScan(*join.children[0], column_index);
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Picks the layout of the pointer table of a hash join
+static JoinHashTableLayout PlanHashTableLayout(ClientContext &context, idx_t build_cardinality) {
+	auto layout = ClientConfig::GetConfig(context).hash_join_layout;
+	if (sizeof(data_ptr_t) != sizeof(hash_t)) {
+		// the salts are stored in the upper bits of 64-bit pointers
+		return JoinHashTableLayout::CHAINED;
+	}
+	if (layout != JoinHashTableLayout::AUTOMATIC) {
+		return layout;
+	}
+	// small pointer tables stay in cache, so rejecting keys by their salt only pays off for large build sides
+	return build_cardinality >= JoinHashTable::LINEAR_PROBING_THRESHOLD ? JoinHashTableLayout::LINEAR_PROBING
+	                                                                    : JoinHashTableLayout::CHAINED;
+}
+
+//! Plans the filters that a hash join derives from its build side and pushes into a table scan on its probe side
+static void PlanJoinFilterPushdown(PhysicalHashJoin &join) {
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		// probe-side rows without a join partner are not part of the result
+		break;
+	default:
+		return;
+	}
+	auto build_cardinality = join.children[1]->estimated_cardinality;
+	auto plan_bloom_filter = build_cardinality * BloomFilter::BITS_PER_VALUE <= BloomFilter::MAXIMUM_BIT_COUNT;
+
+	optional_ptr<PhysicalTableScan> probe_scan;
+	vector<JoinFilterPushdownColumn> filters;
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &condition = join.conditions[cond_idx];
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL ||
+		    condition.left->type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		auto &type = condition.left->return_type;
+		JoinFilterPushdownColumn filter;
+		filter.join_condition = cond_idx;
+		filter.min_max = type.IsIntegral();
+		filter.bloom_filter = plan_bloom_filter && !type.IsNested();
+		if (!filter.min_max && !filter.bloom_filter) {
+			continue;
+		}
+		filter.probe_column_index = condition.left->Cast<BoundReferenceExpression>().index;
+		auto scan = FindProbeTableScan(*join.children[0], filter.probe_column_index);
+		if (!scan || (probe_scan && probe_scan.get() != scan.get())) {
+			continue;
+		}
+		probe_scan = scan;
+		filters.push_back(filter);
+	}
+	if (filters.empty()) {
+		return;
+	}
+	if (!probe_scan->dynamic_filters) {
+		probe_scan->dynamic_filters = make_shared<DynamicTableFilterSet>();
+	}
+	join.filter_pushdown = make_uniq<JoinFilterPushdownInfo>(probe_scan->dynamic_filters,
+	                                                         BloomFilter::GetBitCount(build_cardinality));
+	join.filter_pushdown->filters = std::move(filters);
+}
+
+//! Whether to plan an equi-join as a sort-merge join instead of a hash join. This is opt-in: both sides must have at
+//! least merge_join_threshold rows. The merge join sorts both of its inputs, it does not use an existing order
+static bool PlanMergeJoin(ClientContext &context, LogicalComparisonJoin &op, const PhysicalOperator &left,
+                          const PhysicalOperator &right) {
+	if (context.PolicyCheckingEnabled()) {
+		// the merge join does not apply the policies of the joined chunks, the hash join does
+		return false;
+	}
+	if (!op.left_projection_map.empty() || !op.right_projection_map.empty()) {
+		// the merge join does not support projection maps
+		return false;
+	}
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+	case JoinType::OUTER:
+		break;
+	default:
+		return false;
+	}
+	const auto threshold = ClientConfig::GetConfig(context).merge_join_threshold;
+	if (threshold == 0 || left.estimated_cardinality < threshold || right.estimated_cardinality < threshold) {
+		return false;
+	}
+	for (auto &cond : op.conditions) {
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Plans an inner equi-join as an index join if one side is a scan of a table with an ART on the join key, and the
+//! other side is small enough that probing the index for each of its rows is cheaper than scanning the table
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	if (op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	if (context.PolicyCheckingEnabled()) {
+		// the fetched rows bypass the table scan, which is where the policies of their chunks are attached
+		return nullptr;
+	}
+	const auto prefer_index_joins = ClientConfig::GetConfig(context).prefer_index_joins;
+	// probe the index of the larger side first
+	const auto right_is_larger = right->estimated_cardinality >= left->estimated_cardinality;
+	for (auto lhs_first : {right_is_larger, !right_is_larger}) {
+		auto &probe = lhs_first ? left : right;
+		auto &scan = lhs_first ? right : left;
+		auto &scan_key = lhs_first ? *op.conditions[0].right : *op.conditions[0].left;
+		if (!prefer_index_joins &&
+		    probe->estimated_cardinality * PhysicalIndexJoin::INDEX_JOIN_COST_FACTOR > scan->estimated_cardinality) {
+			continue;
+		}
+		auto index = PhysicalIndexJoin::FindJoinIndex(context, *scan, scan_key);
+		if (!index) {
+			continue;
+		}
+		return make_uniq<PhysicalIndexJoin>(op, std::move(probe), scan->Cast<PhysicalTableScan>(),
+		                                    std::move(op.conditions[0]), lhs_first, *index, op.left_projection_map,
+		                                    op.right_projection_map, op.estimated_cardinality);
+	}
+	return nullptr;
+}
+
 static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	if (expr.type == ExpressionType::BOUND_REF) {
 		auto &ref = expr.Cast<BoundReferenceExpression>();
@@ -190,12 +377,26 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 
 	unique_ptr<PhysicalOperator> plan;
 	if (has_equality && !prefer_range_joins) {
+		// small input against an indexed table: probe the index instead of scanning the table
+		plan = PlanIndexJoin(context, op, left, right);
+		if (plan) {
+			return plan;
+		}
+	}
+	if (has_equality && !prefer_range_joins && PlanMergeJoin(context, op, *left, *right)) {
+		// large inputs: sort and merge them instead of building a hash table
+		plan = make_uniq<PhysicalPiecewiseMergeJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+		                                             op.join_type, op.estimated_cardinality);
+	} else if (has_equality && !prefer_range_joins) {
 		// Equality join with small number of keys : possible perfect join optimization
 		PerfectHashJoinStats perfect_join_stats;
 		CheckForPerfectJoinOpt(op, perfect_join_stats);
-		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
-		                                   op.join_type, op.left_projection_map, op.right_projection_map,
-		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		auto ht_layout = PlanHashTableLayout(context, right->estimated_cardinality);
+		auto hash_join = make_uniq<PhysicalHashJoin>(
+		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
+		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		hash_join->ht_layout = ht_layout;
+		plan = std::move(hash_join);
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
@@ -228,12 +429,125 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	return plan;
 }
 
+//! Whether two build-side plans produce the same result (for the simple plans that dimension tables are built from)
+static bool BuildSidesAreEqual(const PhysicalOperator &left, const PhysicalOperator &right) {
+	switch (left.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+	case PhysicalOperatorType::FILTER:
+	case PhysicalOperatorType::PROJECTION:
+		break;
+	default:
+		return false;
+	}
+	if (left.types != right.types || left.children.size() != right.children.size() || !left.Equals(right)) {
+		return false;
+	}
+	for (idx_t child_idx = 0; child_idx < left.children.size(); child_idx++) {
+		if (!BuildSidesAreEqual(*left.children[child_idx], *right.children[child_idx])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Whether two hash joins build the same hash table
+static bool HashJoinBuildsAreEqual(const PhysicalHashJoin &left, const PhysicalHashJoin &right) {
+	if (left.join_type != right.join_type || left.ht_layout != right.ht_layout ||
+	    left.conditions.size() != right.conditions.size()) {
+		return false;
+	}
+	for (idx_t cond_idx = 0; cond_idx < left.conditions.size(); cond_idx++) {
+		auto &left_condition = left.conditions[cond_idx];
+		auto &right_condition = right.conditions[cond_idx];
+		if (left_condition.comparison != right_condition.comparison ||
+		    left_condition.left->return_type != right_condition.left->return_type ||
+		    !left_condition.right->Equals(*right_condition.right)) {
+			return false;
+		}
+	}
+	if (left.payload_column_idxs != right.payload_column_idxs || left.payload_types != right.payload_types ||
+	    left.rhs_output_columns != right.rhs_output_columns) {
+		return false;
+	}
+	return BuildSidesAreEqual(*left.children[1], *right.children[1]);
+}
+
+static void CollectSharableHashJoins(PhysicalOperator &op, vector<reference<PhysicalHashJoin>> &joins,
+                                     bool &has_recursive_cte) {
+	// shared builds that do not fit in memory are built by every join again, so we only share the builds of (small)
+	// dimension tables
+	static constexpr const idx_t SHARED_BUILD_THRESHOLD = 1000000;
+	switch (op.type) {
+	case PhysicalOperatorType::RECURSIVE_CTE:
+		has_recursive_cte = true;
+		return;
+	case PhysicalOperatorType::HASH_JOIN: {
+		auto &join = op.Cast<PhysicalHashJoin>();
+		switch (join.join_type) {
+		case JoinType::INNER:
+		case JoinType::LEFT:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+		case JoinType::MARK:
+		case JoinType::SINGLE:
+			// these joins do not modify the hash table while probing it
+			if (join.delim_types.empty() && join.children[1]->estimated_cardinality <= SHARED_BUILD_THRESHOLD) {
+				joins.push_back(join);
+			}
+			break;
+		default:
+			break;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	for (auto &child : op.children) {
+		CollectSharableHashJoins(*child, joins, has_recursive_cte);
+	}
+}
+
+void PhysicalPlanGenerator::PlanSharedHashJoinBuilds(PhysicalOperator &plan) {
+	vector<reference<PhysicalHashJoin>> joins;
+	bool has_recursive_cte = false;
+	CollectSharableHashJoins(plan, joins, has_recursive_cte);
+	if (has_recursive_cte) {
+		return;
+	}
+	for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+		auto &join = joins[join_idx].get();
+		if (join.shared_build) {
+			// already part of a group
+			continue;
+		}
+		for (idx_t other_idx = join_idx + 1; other_idx < joins.size(); other_idx++) {
+			auto &other = joins[other_idx].get();
+			if (other.shared_build || !HashJoinBuildsAreEqual(join, other)) {
+				continue;
+			}
+			if (!join.shared_build) {
+				join.shared_build = make_shared<SharedHashJoinBuild>();
+				// the filters are only pushed by the join that builds the hash table, so we do not plan them
+				join.filter_pushdown.reset();
+			}
+			other.shared_build = join.shared_build;
+			other.filter_pushdown.reset();
+		}
+	}
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparisonJoin &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
 		return PlanAsOfJoin(op);
-	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		return PlanComparisonJoin(op);
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto plan = PlanComparisonJoin(op);
+		if (plan->type == PhysicalOperatorType::HASH_JOIN && recursive_cte_tables.empty()) {
+			PlanJoinFilterPushdown(plan->Cast<PhysicalHashJoin>());
+		}
+		return plan;
+	}
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
 		return PlanDelimJoin(op);
 	default:
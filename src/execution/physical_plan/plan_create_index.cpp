@@ -3,8 +3,10 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
-#include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/schema/physical_create_index.hpp"
+#include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
@@ -15,7 +17,7 @@ namespace duckdb {
 
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateIndex &op) {
 	// generate a physical plan for the parallel index creation which consists of the following operators
-	// table scan - projection (for expression execution) - filter (NOT NULL) - order (if applicable) - create index
+	// table scan - projection (for expression execution) - filter (NOT NULL) - create index
 
 	D_ASSERT(op.children.size() == 1);
 	auto table_scan = CreatePlan(*op.children[0]);
@@ -30,10 +32,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
-	// if we get here and the index type is not ART, we throw an exception
-	// because we don't support any other index type yet. However, an operator extension could have
-	// replaced this part of the plan with a different index creation operator.
-	if (op.info->index_type != ART::TYPE_NAME) {
+	// if we get here and the index type is not known, we throw an exception. However, an operator extension could
+	// have replaced this part of the plan with a different index creation operator.
+	auto index_type = DBConfig::GetConfig(context).GetIndexTypes().FindByName(op.info->index_type);
+	if (!index_type) {
 		throw BinderException("Unknown index type: " + op.info->index_type);
 	}
 
@@ -76,45 +78,21 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
-	// determine if we sort the data prior to index creation
-	// we don't sort, if either VARCHAR or compound key
-	auto perform_sorting = true;
-	if (op.unbound_expressions.size() > 1) {
-		perform_sorting = false;
-	} else if (op.unbound_expressions[0]->return_type.InternalType() == PhysicalType::VARCHAR) {
-		perform_sorting = false;
-	}
-
-	// actual physical create index operator
-
-	auto physical_create_index =
-	    make_uniq<PhysicalCreateARTIndex>(op, op.table, op.info->column_ids, std::move(op.info),
-	                                      std::move(op.unbound_expressions), op.estimated_cardinality, perform_sorting);
-
-	if (perform_sorting) {
+	// actual physical create index operator, which partitions and sorts the keys itself for ARTs
 
-		// optional order operator
-		vector<BoundOrderByNode> orders;
-		vector<idx_t> projections;
-		for (idx_t i = 0; i < new_column_types.size() - 1; i++) {
-			auto col_expr = make_uniq_base<Expression, BoundReferenceExpression>(new_column_types[i], i);
-			orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST, std::move(col_expr));
-			projections.emplace_back(i);
-		}
-		projections.emplace_back(new_column_types.size() - 1);
-
-		auto physical_order = make_uniq<PhysicalOrder>(new_column_types, std::move(orders), std::move(projections),
-		                                               op.estimated_cardinality);
-		physical_order->children.push_back(std::move(null_filter));
-
-		physical_create_index->children.push_back(std::move(physical_order));
+	unique_ptr<PhysicalOperator> physical_create_index;
+	if (op.info->index_type == ART::TYPE_NAME) {
+		physical_create_index =
+		    make_uniq<PhysicalCreateARTIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                      std::move(op.unbound_expressions), op.estimated_cardinality);
 	} else {
-
-		// no ordering
-		physical_create_index->children.push_back(std::move(null_filter));
+		physical_create_index =
+		    make_uniq<PhysicalCreateIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                   std::move(op.unbound_expressions), *index_type, op.estimated_cardinality);
 	}
+	physical_create_index->children.push_back(std::move(null_filter));
 
-	return std::move(physical_create_index);
+	return physical_create_index;
 }
 
 } // namespace duckdb
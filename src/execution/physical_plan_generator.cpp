@@ -58,6 +58,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(unique_ptr<Logica
 	// then create the main physical plan
 	profiler.StartPhase("create_plan");
 	auto plan = CreatePlan(*op);
+	PlanSharedHashJoinBuilds(*plan);
 	profiler.EndPhase();
 
 	plan->Verify();
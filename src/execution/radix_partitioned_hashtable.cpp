@@ -161,6 +161,10 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If at least this fraction of the rows that filled up a HT created a new group, the HT hardly reduces the data
+	static constexpr const double PASSTHROUGH_THRESHOLD = 0.95;
+	//! How many chunks to pass through without looking up groups before trying the HT again
+	static constexpr const idx_t PASSTHROUGH_CHUNK_COUNT = 128;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -396,11 +400,17 @@ public:
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 
+	//! Number of rows that were added to the HT since it was last reset
+	idx_t sink_count;
+	//! Number of chunks that are still to be passed through without looking up their groups
+	idx_t passthrough_chunks;
+
 	//! Vector of history hashes of each chunk.
 	vector<RadixHashState> chunk_hashes;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), passthrough_chunks(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -519,8 +529,6 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
-
 	if (context.client.PolicyCheckingEnabled()) {
 		Vector hashes(LogicalType::HASH);
 		group_chunk.Hash(hashes);
@@ -530,17 +538,36 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		                                 lstate.group_chunk.GetActiveUUID());
 	}
 
+	if (lstate.passthrough_chunks != 0) {
+		// The groups are (nearly) unique, append the rows to the partitioned data without looking them up
+		ht.AddChunkPassthrough(group_chunk, payload_input, filter);
+		lstate.passthrough_chunks--;
+		MaybeRepartition(context.client, gstate, lstate, gstate.active_threads);
+		return;
+	}
+
+	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
+
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
 	const idx_t active_threads = gstate.active_threads;
 	if (active_threads > 2) {
+		// If almost every row created a new group, the HT did not reduce the data. The groups are combined in the
+		// Finalize anyway, so we skip the lookups for the next chunks, and try the HT again afterwards
+		if (double(ht.Count()) >= RadixHTConfig::PASSTHROUGH_THRESHOLD * double(lstate.sink_count)) {
+			lstate.passthrough_chunks = RadixHTConfig::PASSTHROUGH_CHUNK_COUNT;
+		}
+
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		lstate.sink_count = 0;
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+		// With 1 or 2 threads the HT is never reset and fully reduces the data, so we never pass through either
 	}
 
 	// Check if we need to repartition
@@ -549,6 +576,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		// We repartitioned, but we didn't clear the pointer table / reset the count because we're on 1 or 2 threads
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		lstate.sink_count = 0;
 	}
 
 	// TODO: combine early and often
@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/brin/block_range_index.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -52,6 +53,8 @@ struct TableScanGlobalState : public GlobalTableFunctionState {
 
 	ParallelTableScanState state;
 	idx_t max_threads;
+	//! The row id ranges that the scan is restricted to (if any)
+	optional_ptr<const vector<RowIdRange>> row_ranges;
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
@@ -74,10 +77,11 @@ static unique_ptr<LocalTableFunctionState> TableScanInitLocal(ExecutionContext &
 		auto storage_idx = GetStorageIndex(bind_data.table, col);
 		col = storage_idx;
 	}
+	auto &tsgs = gstate->Cast<TableScanGlobalState>();
 	result->scan_state.Initialize(std::move(column_ids), input.filters.get());
+	result->scan_state.table_state.row_ranges = tsgs.row_ranges;
 	TableScanParallelStateNext(context.client, input.bind_data.get(), result.get(), gstate);
 	if (input.CanRemoveFilterColumns()) {
-		auto &tsgs = gstate->Cast<TableScanGlobalState>();
 		result->all_columns.Initialize(context.client, tsgs.scanned_types);
 	}
 
@@ -221,23 +225,79 @@ unique_ptr<NodeStatistics> TableScanCardinality(ClientContext &context, const Fu
 // Index Scan
 //===--------------------------------------------------------------------===//
 struct IndexScanGlobalState : public GlobalTableFunctionState {
-	explicit IndexScanGlobalState(data_ptr_t row_id_data) : row_ids(LogicalType::ROW_TYPE, row_id_data) {
+	IndexScanGlobalState() : position(0) {
 	}
 
-	Vector row_ids;
 	ColumnFetchState fetch_state;
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
-	bool finished;
+	//! The sorted row ids to fetch
+	vector<row_t> row_ids;
+	//! The next row id to fetch
+	idx_t position;
+
+	vector<idx_t> projection_ids;
+	//! All scanned columns, if columns that are only used by filters are projected out
+	DataChunk all_columns;
+
+	//! The table scan that runs instead, if the filters match too many rows or the index is a BRIN
+	unique_ptr<GlobalTableFunctionState> table_scan;
+	//! The candidate row id ranges of a BRIN, that the table scan is restricted to
+	unique_ptr<vector<RowIdRange>> row_ranges;
+
+	bool CanRemoveFilterColumns() const {
+		return !projection_ids.empty();
+	}
+
+	idx_t MaxThreads() const override {
+		return table_scan ? table_scan->MaxThreads() : 1;
+	}
 };
 
+//! Fetches the row ids of an ART scan, or the row id ranges of a BRIN scan. Returns false if the rows have to be
+//! scanned by a table scan instead, i.e., for a BRIN or if the row ids exceed the limit for index scans
+static bool IndexScanFetchRows(ClientContext &context, const TableScanBindData &bind_data,
+                               IndexScanGlobalState &state) {
+	if (!bind_data.index_state) {
+		// e.g. a deserialized plan
+		return false;
+	}
+	auto &storage = bind_data.table.GetStorage();
+	auto &db_config = DBConfig::GetConfig(context);
+	auto max_count = MaxValue<idx_t>(db_config.options.index_scan_max_count,
+	                                 idx_t(db_config.options.index_scan_percentage * double(storage.GetTotalRows())));
+
+	auto &transaction = Transaction::Get(context, bind_data.table.catalog);
+	bool scanned = false;
+	storage.info->indexes.Scan([&](Index &index) {
+		if (index.name != bind_data.index_name || index.IsUnknown()) {
+			return false;
+		}
+		auto &index_state = *bind_data.index_state;
+		if (index.index_type == ART::TYPE_NAME) {
+			scanned = index.Cast<ART>().Scan(transaction, storage, index_state, max_count, state.row_ids);
+		} else if (index.index_type == BlockRangeIndex::TYPE_NAME) {
+			// the candidate rows of a BRIN are contiguous, so they are scanned like the table
+			state.row_ranges = make_uniq<vector<RowIdRange>>();
+			index.Cast<BlockRangeIndex>().Scan(storage, index_state, *state.row_ranges);
+		}
+		return true;
+	});
+	if (!scanned) {
+		state.row_ids.clear();
+	}
+	return scanned;
+}
+
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
-	data_ptr_t row_id_data = nullptr;
-	if (!bind_data.result_ids.empty()) {
-		row_id_data = (data_ptr_t)&bind_data.result_ids[0]; // NOLINT - this is not pretty
+	auto result = make_uniq<IndexScanGlobalState>();
+	if (!IndexScanFetchRows(context, bind_data, *result)) {
+		// scan the table (or the candidate ranges of a BRIN) in parallel instead, the filters are applied on top
+		result->table_scan = TableScanInitGlobal(context, input);
+		result->table_scan->Cast<TableScanGlobalState>().row_ranges = result->row_ranges.get();
+		return std::move(result);
 	}
-	auto result = make_uniq<IndexScanGlobalState>(row_id_data);
 	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
 
 	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
@@ -249,23 +309,59 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
 	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
 
-	result->finished = false;
+	if (input.CanRemoveFilterColumns()) {
+		result->projection_ids = input.projection_ids;
+		vector<LogicalType> scanned_types;
+		const auto &columns = bind_data.table.GetColumns();
+		for (const auto &col_idx : input.column_ids) {
+			if (col_idx == COLUMN_IDENTIFIER_ROW_ID) {
+				scanned_types.emplace_back(LogicalType::ROW_TYPE);
+			} else {
+				scanned_types.push_back(columns.GetColumn(LogicalIndex(col_idx)).Type());
+			}
+		}
+		result->all_columns.Initialize(context, scanned_types);
+	}
 	return std::move(result);
 }
 
+static unique_ptr<LocalTableFunctionState> IndexScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                              GlobalTableFunctionState *gstate) {
+	auto &state = gstate->Cast<IndexScanGlobalState>();
+	if (!state.table_scan) {
+		return nullptr;
+	}
+	return TableScanInitLocal(context, input, state.table_scan.get());
+}
+
 static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &state = data_p.global_state->Cast<IndexScanGlobalState>();
+	if (state.table_scan) {
+		TableFunctionInput table_scan_input(data_p.bind_data, data_p.local_state, state.table_scan.get());
+		TableScanFunc(context, table_scan_input, output);
+		return;
+	}
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
-	if (!state.finished) {
-		bind_data.table.GetStorage().Fetch(transaction, output, state.column_ids, state.row_ids,
-		                                   bind_data.result_ids.size(), state.fetch_state);
-		state.finished = true;
+	auto &result = state.CanRemoveFilterColumns() ? state.all_columns : output;
+	result.Reset();
+	// the row ids are sorted, so every batch fetches rows that are close to each other in the table
+	auto &row_ids = state.row_ids;
+	while (result.size() == 0 && state.position < row_ids.size()) {
+		auto fetch_count = MinValue<idx_t>(row_ids.size() - state.position, STANDARD_VECTOR_SIZE);
+		auto row_id_data = (data_ptr_t)(row_ids.data() + state.position); // NOLINT - this is not pretty
+		Vector row_id_vector(LogicalType::ROW_TYPE, row_id_data);
+		bind_data.table.GetStorage().Fetch(transaction, result, state.column_ids, row_id_vector, fetch_count,
+		                                   state.fetch_state);
+		state.position += fetch_count;
 	}
-	if (output.size() == 0) {
-		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+	if (result.size() == 0) {
+		local_storage.Scan(state.local_storage_state.local_state, state.column_ids, result);
+	}
+	if (state.CanRemoveFilterColumns()) {
+		output.ReferenceColumns(state.all_columns, state.projection_ids);
 	}
 }
 
@@ -307,11 +403,6 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 		// if there were filters before we can't convert this to an index scan
 		return;
 	}
-	if (!get.projection_ids.empty()) {
-		// if columns were pruned by RemoveUnusedColumns we can't convert this to an index scan,
-		// because index scan does not support filter_prune (yet)
-		return;
-	}
 	if (filters.empty()) {
 		// no indexes or no filters: skip the pushdown
 		return;
@@ -326,43 +417,41 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 			return false;
 		}
 
-		if (index.index_type != ART::TYPE_NAME) {
-			// only ART indexes are supported for now
+		if (index.index_type != ART::TYPE_NAME && index.index_type != BlockRangeIndex::TYPE_NAME) {
+			// only ART and BRIN indexes are supported for now
 			return false;
 		}
 
-		auto &art_index = index.Cast<ART>();
-
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
-		}
-
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
-			return false;
+		vector<unique_ptr<Expression>> index_expressions;
+		for (auto &unbound_expression : index.unbound_expressions) {
+			auto index_expression = unbound_expression->Copy();
+			bool rewrite_possible = true;
+			RewriteIndexExpression(index, get, *index_expression, rewrite_possible);
+			if (!rewrite_possible) {
+				// could not rewrite!
+				return false;
+			}
+			index_expressions.push_back(std::move(index_expression));
 		}
 
-		// try to find a matching index for any of the filter expressions
+		// try to combine the filter expressions into a scan of the index
 		auto &transaction = Transaction::Get(context, bind_data.table.catalog);
-
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-				if (art_index.Scan(transaction, storage, *index_state, STANDARD_VECTOR_SIZE, bind_data.result_ids)) {
-					// use an index scan!
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-				} else {
-					bind_data.result_ids.clear();
-				}
-				return true;
-			}
+		unique_ptr<IndexScanState> index_state;
+		if (index.index_type == ART::TYPE_NAME) {
+			index_state = index.Cast<ART>().TryInitializeScan(transaction, index_expressions, filters);
+		} else {
+			index_state = index.Cast<BlockRangeIndex>().TryInitializeScan(*index_expressions[0], filters);
 		}
-		return false;
+		if (!index_state) {
+			return false;
+		}
+		// use an index scan! the row ids are fetched when the scan starts, which falls back to a table scan if the
+		// filters are not selective enough
+		bind_data.is_index_scan = true;
+		bind_data.index_name = index.name;
+		bind_data.index_state = std::move(index_state);
+		get.function = TableScanFunction::GetIndexScanFunction();
+		return true;
 	});
 }
 
@@ -380,7 +469,7 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(102, "table", bind_data.table.name);
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
-	serializer.WriteProperty(105, "result_ids", bind_data.result_ids);
+	// the row ids of an index scan are fetched at execution time, so a deserialized index scan scans the table
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -395,13 +484,13 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	auto result = make_uniq<TableScanBindData>(catalog_entry.Cast<DuckTableEntry>());
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
-	deserializer.ReadProperty(105, "result_ids", result->result_ids);
+	deserializer.ReadDeletedProperty<vector<row_t>>(105, "result_ids");
 	return std::move(result);
 }
 
 TableFunction TableScanFunction::GetIndexScanFunction() {
 	TableFunction scan_function("index_scan", {}, IndexScanFunction);
-	scan_function.init_local = nullptr;
+	scan_function.init_local = IndexScanInitLocal;
 	scan_function.init_global = IndexScanInitGlobal;
 	scan_function.statistics = TableScanStatistics;
 	scan_function.dependency = TableScanDependency;
@@ -412,6 +501,7 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	scan_function.get_batch_index = nullptr;
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = false;
+	scan_function.filter_prune = true;
 	scan_function.get_bind_info = TableScanGetBindInfo;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
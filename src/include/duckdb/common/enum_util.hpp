@@ -68,6 +68,8 @@ enum class BitpackingMode : uint8_t;
 
 enum class BlockState : uint8_t;
 
+enum class BufferEvictionPolicy : uint8_t;
+
 enum class CAPIResultSetType : uint8_t;
 
 enum class CSVState : uint8_t;
@@ -112,6 +114,8 @@ enum class DistinctType : uint8_t;
 
 enum class ErrorType : uint16_t;
 
+enum class EvictionQueueType : uint8_t;
+
 enum class ExceptionFormatValueType : uint8_t;
 
 enum class ExceptionType : uint8_t;
@@ -156,6 +160,8 @@ enum class InsertColumnOrder : uint8_t;
 
 enum class InterruptMode : uint8_t;
 
+enum class JoinHashTableLayout : uint8_t;
+
 enum class JoinRefType : uint8_t;
 
 enum class JoinType : uint8_t;
@@ -296,6 +302,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TemporaryBufferSize : uint64_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionType : uint8_t;
@@ -379,6 +387,9 @@ const char* EnumUtil::ToChars<BitpackingMode>(BitpackingMode value);
 template<>
 const char* EnumUtil::ToChars<BlockState>(BlockState value);
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value);
 
@@ -445,6 +456,9 @@ const char* EnumUtil::ToChars<DistinctType>(DistinctType value);
 template<>
 const char* EnumUtil::ToChars<ErrorType>(ErrorType value);
 
+template<>
+const char* EnumUtil::ToChars<EvictionQueueType>(EvictionQueueType value);
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value);
 
@@ -511,6 +525,9 @@ const char* EnumUtil::ToChars<InsertColumnOrder>(InsertColumnOrder value);
 template<>
 const char* EnumUtil::ToChars<InterruptMode>(InterruptMode value);
 
+template<>
+const char* EnumUtil::ToChars<JoinHashTableLayout>(JoinHashTableLayout value);
+
 template<>
 const char* EnumUtil::ToChars<JoinRefType>(JoinRefType value);
 
@@ -721,6 +738,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferSize>(TemporaryBufferSize value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -818,6 +838,9 @@ BitpackingMode EnumUtil::FromString<BitpackingMode>(const char *value);
 template<>
 BlockState EnumUtil::FromString<BlockState>(const char *value);
 
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value);
+
 template<>
 CAPIResultSetType EnumUtil::FromString<CAPIResultSetType>(const char *value);
 
@@ -884,6 +907,9 @@ DistinctType EnumUtil::FromString<DistinctType>(const char *value);
 template<>
 ErrorType EnumUtil::FromString<ErrorType>(const char *value);
 
+template<>
+EvictionQueueType EnumUtil::FromString<EvictionQueueType>(const char *value);
+
 template<>
 ExceptionFormatValueType EnumUtil::FromString<ExceptionFormatValueType>(const char *value);
 
@@ -950,6 +976,9 @@ InsertColumnOrder EnumUtil::FromString<InsertColumnOrder>(const char *value);
 template<>
 InterruptMode EnumUtil::FromString<InterruptMode>(const char *value);
 
+template<>
+JoinHashTableLayout EnumUtil::FromString<JoinHashTableLayout>(const char *value);
+
 template<>
 JoinRefType EnumUtil::FromString<JoinRefType>(const char *value);
 
@@ -1160,6 +1189,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TemporaryBufferSize EnumUtil::FromString<TemporaryBufferSize>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy the buffer pool uses to pick which blocks to evict
+//! LRU: blocks are evicted in the order in which they were last unpinned
+//! TWO_QUEUE: blocks that have been used once since they were loaded are evicted before blocks that have been re-used,
+//! so that a single large scan cannot flush frequently used blocks out of memory
+enum class BufferEvictionPolicy : uint8_t { LRU = 0, TWO_QUEUE = 1 };
+
+} // namespace duckdb
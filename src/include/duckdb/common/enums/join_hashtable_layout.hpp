@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/join_hashtable_layout.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The layout of the pointer table of the JoinHashTable
+//! AUTOMATIC: let the planner pick a layout based on the estimated size of the build side
+//! CHAINED: every slot points to a chain of all rows whose hashes map to that slot
+//! LINEAR_PROBING: open addressing with linear probing, every slot stores a salt (the upper bits of the hash) next
+//! to the pointer, so that most non-matching keys are rejected without touching the rows
+enum class JoinHashTableLayout : uint8_t { AUTOMATIC = 0, CHAINED = 1, LINEAR_PROBING = 2 };
+
+} // namespace duckdb
@@ -36,6 +36,8 @@ public:
 	data_ptr_t buffer;
 	//! The size of the portion that users can write to, this is equivalent to internal_size - BLOCK_HEADER_SIZE
 	uint64_t size;
+	//! The NUMA node of the thread that allocated the buffer
+	idx_t numa_node;
 
 public:
 	//! Read into the FileBuffer from the specified location.
@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! NumaTopology describes the NUMA nodes of the machine. On Linux the topology is read from sysfs, everywhere else
+//! (or if sysfs cannot be read) the machine is treated as a single node.
+class NumaTopology {
+public:
+	//! Get the topology of this machine (read once)
+	static const NumaTopology &Get();
+
+	//! The number of NUMA nodes
+	idx_t NodeCount() const;
+	//! Bind the calling thread to the CPUs of a node, returns false if that is not supported
+	bool BindThread(idx_t node) const;
+	//! The node of the CPU the calling thread is currently running on
+	idx_t CurrentNode() const;
+
+	//! Parse a CPU list such as "0-3,8,10-11"
+	static vector<idx_t> ParseCPUList(const string &list);
+
+private:
+	NumaTopology();
+
+	//! The CPUs of each node
+	vector<vector<idx_t>> node_cpus;
+	//! The node of each CPU
+	vector<idx_t> cpu_nodes;
+};
+
+} // namespace duckdb
@@ -22,6 +22,11 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Strings up to this length are inlined entirely into the sorting key, longer strings get a prefix
+	static constexpr idx_t MAX_INLINED_STRING_SIZE = 32;
+	//! The key bytes shared by the prefixes of the strings that are not inlined, each gets at least 12 bytes
+	static constexpr idx_t STRING_PREFIX_BUDGET = 32;
+	static constexpr idx_t MIN_STRING_PREFIX_SIZE = 12;
 };
 
 struct SortLayout {
@@ -61,6 +66,10 @@ public:
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
 	void InitializeMergeRound();
+	//! Initializes the global sort state for merging all sorted blocks at once, starting with the partition boundaries
+	void InitializeKWayMerge();
+	//! Slices the sorted blocks at the partition boundaries, once these have been computed
+	void PrepareKWayMergePartitions();
 	//! Completes the cascaded merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
@@ -96,6 +105,16 @@ public:
 	idx_t num_pairs;
 	idx_t l_start;
 	idx_t r_start;
+
+	//! Progress in the k-way merge
+	idx_t splitter_idx;
+	idx_t partition_idx;
+	idx_t num_partitions;
+	//! The boundaries of the partitions in each sorted block
+	vector<vector<idx_t>> partition_bounds;
+	//! The slices of the sorted blocks that are merged into each partition, and where they start in their first block
+	vector<vector<unique_ptr<SortedBlock>>> partition_slices;
+	vector<vector<idx_t>> partition_slice_starts;
 };
 
 struct LocalSortState {
@@ -204,6 +223,59 @@ private:
 	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
 };
 
+struct KWayMergeSorter {
+public:
+	KWayMergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
+
+	//! Computes partition boundaries until the boundaries of all partitions are known
+	void ComputeSplitters();
+	//! Finds and merges partitions until all sorted blocks are merged into one.
+	//! Only the sorting keys are merged, the payload of each partition is gathered afterwards
+	void PerformKWayMerge();
+
+private:
+	//! The global sorting state
+	GlobalSortState &state;
+	//! The sorting and payload layouts
+	BufferManager &buffer_manager;
+	const SortLayout &sort_layout;
+
+	//! The readers used to find the partition boundaries in the sorted blocks, and their row counts
+	vector<unique_ptr<SBScanState>> block_scans;
+	vector<idx_t> block_counts;
+
+	//! The readers of the input blocks, and where they start in their first block
+	vector<unique_ptr<SBScanState>> inputs;
+	vector<idx_t> input_starts;
+	//! The input of each merged row, used to gather the payload
+	vector<idx_t> merged_inputs;
+	//! Input and output blocks
+	vector<unique_ptr<SortedBlock>> input_blocks;
+	SortedBlock *result;
+
+private:
+	//! Takes the slices of the sorted blocks that will be merged next
+	void GetNextPartition();
+	//! Finds the boundaries of the rows that precede the row with the given rank in the merged output
+	void GetSplitters(const idx_t rank, vector<idx_t> &splitters);
+	//! Counts the rows of a sorted block that precede a row of another sorted block using binary search
+	idx_t CountPreceding(const idx_t block_idx, const idx_t pivot_block_idx, const idx_t pivot_idx);
+	//! Compare values within SortedBlocks using a global index
+	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+
+	//! Merges the sorting keys of the input blocks into the result block using a loser tree, then gathers the payload
+	void MergePartition();
+	//! Whether the current row of input 'l' comes before the current row of input 'r'
+	bool InputSmaller(const idx_t l, const idx_t r);
+	//! Moves an input to the next key, releasing and skipping the key blocks that it has finished
+	void AdvanceKeys(SBScanState &input);
+	//! Moves an input to the next payload row, releasing and skipping the payload blocks that it has finished
+	void AdvancePayload(SBScanState &input);
+	//! Appends the current row of an input to the result
+	void AppendRow(SortedData &result_data, SortedData &input_data, SBScanState &input, BufferHandle &result_handle,
+	               BufferHandle &result_heap_handle);
+};
+
 struct SBIterator {
 	static int ComparisonValue(ExpressionType comparison);
 
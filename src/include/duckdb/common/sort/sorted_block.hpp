@@ -32,6 +32,8 @@ public:
 	void CreateBlock();
 	//! Create a slice that holds the rows between the start and end indices
 	unique_ptr<SortedData> CreateSlice(idx_t start_block_index, idx_t end_block_index, idx_t end_entry_index);
+	//! Create a copy that shares the (read-only) blocks of this object, owned by another global state
+	unique_ptr<SortedData> CreateCopy(GlobalSortState &target) const;
 	//! Unswizzles all
 	void Unswizzle();
 
@@ -69,6 +71,8 @@ public:
 	void GlobalToLocalIndex(const idx_t &global_idx, idx_t &local_block_index, idx_t &local_entry_index);
 	//! Create a slice that holds the rows between the start and end indices
 	unique_ptr<SortedBlock> CreateSlice(const idx_t start, const idx_t end, idx_t &entry_idx);
+	//! Create a copy that shares the (read-only) blocks of this block, owned by another global state
+	unique_ptr<SortedBlock> CreateCopy(GlobalSortState &target) const;
 
 	//! Size (in bytes) of the heap of this block
 	idx_t HeapSize() const;
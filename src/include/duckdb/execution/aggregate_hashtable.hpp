@@ -112,6 +112,8 @@ public:
 		Vector addresses;
 		unsafe_unique_array<UnifiedVectorFormat> group_data;
 		DataChunk group_chunk;
+		//! The groups packed into 64-bit words (only if the groups are small fixed-width integers)
+		unsafe_unique_array<uint64_t> packed_groups;
 	} state;
 
 	//! Get the layout of this HT
@@ -133,6 +135,9 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, Vector &group_hashes, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, AggregateType filter);
+	//! Add the given data to the HT without looking up existing groups: every row becomes a group of its own. This
+	//! skips the pointer table entirely, the duplicate groups are combined when the partitions are finalized
+	void AddChunkPassthrough(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Fetch the aggregates for specific groups from the HT and place them in the result
 	void FetchAggregates(DataChunk &groups, DataChunk &result);
@@ -177,6 +182,11 @@ private:
 
 	//! Predicates for matching groups (always ExpressionType::COMPARE_EQUAL)
 	vector<ExpressionType> predicates;
+	//! Number of 64-bit words that the groups are packed into for matching, or 0 if they are matched with the
+	//! RowMatcher. Small fixed-width integer groups are stored contiguously in the rows, and can be matched at once
+	idx_t packed_group_words;
+	//! Masks of the bytes of the packed groups within the words
+	uint64_t packed_group_masks[2];
 
 	//! The number of groups in the HT
 	idx_t count;
@@ -207,6 +217,12 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! References the groups and their hashes in the append state and converts them to unified format
+	void InitializeGroupChunk(DataChunk &groups, Vector &group_hashes);
+	//! Packs the groups in the append state into 64-bit words. Returns false if they contain NULL values
+	bool PackGroups(idx_t count);
+	//! Updates the aggregates of the rows in the addresses of the append state with the payload
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Verify the pointer table of the HT
 	void Verify();
@@ -23,6 +23,7 @@ class PhysicalOperator;
 class PipelineExecutor;
 class OperatorState;
 class QueryProfiler;
+class TemporaryMemoryAdmission;
 class ThreadContext;
 class Task;
 
@@ -143,6 +144,8 @@ private:
 	idx_t root_pipeline_idx;
 	//! The producer of this query
 	unique_ptr<ProducerToken> producer;
+	//! The admission of this query, if it is memory-intensive and the number of such queries is limited
+	unique_ptr<TemporaryMemoryAdmission> admission;
 	//! List of events
 	vector<shared_ptr<Event>> events;
 	//! The query profiler
@@ -53,9 +53,12 @@ public:
 	//! True, if the ART owns its data
 	bool owns_data;
 
-	//! Try to initialize a scan on the index with the given expression and filter
-	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
-	                                             const Expression &filter_expr);
+	//! Try to initialize a scan on the index with the given key expressions (one per key column) and filters. The
+	//! scan combines all filters on the key columns: comparisons, BETWEEN, IN lists and disjunctions of them on the
+	//! first key column, or equalities on leading key columns followed by any of these on the next key column
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
 
 	//! Performs a lookup on the index, fetching up to max_count result IDs. Returns true if all row IDs were fetched,
 	//! and false otherwise
@@ -85,9 +88,16 @@ public:
 
 	//! Construct an ART from a vector of sorted keys
 	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
+	//! Construct the subtree below the first "depth" bytes of a vector of sorted keys, which all share these bytes.
+	//! The subtree does not contain the shared bytes
+	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, row_t *row_ids, idx_t depth);
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
+	//! Search equal values for the keys at "positions" (which are sorted by key), and fetch their row IDs. Appends each
+	//! row ID to "result_ids", and the position of its key to "result_positions"
+	void SearchEqualSorted(vector<ARTKey> &keys, const vector<sel_t> &positions, vector<row_t> &result_ids,
+	                       vector<sel_t> &result_positions);
 	//! Search equal values used for joins that do not need to fetch data
 	void SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size);
 
@@ -98,11 +108,25 @@ public:
 	//! index must also be locked during the merge
 	bool MergeIndexes(IndexLock &state, Index &other_index) override;
 
+	//! Returns the buffer ID offsets of each ART of a set of disjoint partitions, such that their nodes do not
+	//! overlap once they are merged in order
+	static vector<ARTFlags> InitializePartitionMerge(const vector<unique_ptr<ART>> &partitions);
+	//! Increments the buffer IDs of all nodes by the offsets of InitializePartitionMerge. Different partitions can
+	//! be prepared concurrently
+	void PreparePartitionMerge(const ARTFlags &flags);
+	//! Merges prepared partitions into this empty ART without traversing their trees. All keys share their first
+	//! "depth" bytes with "prefix_key", and each partition holds the subtree of the keys with "key_bytes[i]" at
+	//! that depth
+	void MergePartitions(vector<unique_ptr<ART>> &partitions, const vector<data_t> &key_bytes,
+	                     const ARTKey &prefix_key, idx_t depth);
+
 	//! Traverses an ART and vacuums the qualifying nodes. The lock obtained from InitializeLock must be held
 	void Vacuum(IndexLock &state) override;
 
 	//! Returns the in-memory usage of the index. The lock obtained from InitializeLock must be held
 	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Unpins the on-disk buffers that previous operations read
+	void UnpinBuffers() override;
 
 	//! Generate ART keys for an input chunk
 	static void GenerateKeys(ArenaAllocator &allocator, DataChunk &input, vector<ARTKey> &keys);
@@ -128,14 +152,15 @@ private:
 	//! Erase a key from the tree (if a leaf has more than one value) or erase the leaf itself
 	void Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
-	//! Returns all row IDs belonging to a key greater (or equal) than the search key
-	bool SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key less (or equal) than the upper_bound
-	bool SearchLess(ARTIndexScanState &state, ARTKey &upper_bound, bool equal, idx_t max_count,
-	                vector<row_t> &result_ids);
-	//! Returns all row IDs belonging to a key within the range of lower_bound and upper_bound
-	bool SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey &upper_bound, bool left_equal,
-	                      bool right_equal, idx_t max_count, vector<row_t> &result_ids);
+	//! Returns all row IDs belonging to a key within the range of lower_bound and upper_bound. An empty bound does
+	//! not restrict the range
+	bool SearchRange(const ARTKey &lower_bound, bool left_equal, const ARTKey &upper_bound, bool right_equal,
+	                 idx_t max_count, vector<row_t> &result_ids);
+	//! Creates the key of a bound on key column "column" (or of only the prefix, if the value is NULL). If "pad" is
+	//! set, the key is padded with the maximum bytes of the remaining key columns, so that it is not less than any
+	//! key that it is a prefix of
+	ARTKey CreateBoundKey(ArenaAllocator &allocator, const ARTKey &prefix_key, idx_t column, const Value &value,
+	                      bool pad);
 
 	//! Initializes a merge operation by returning a set containing the buffer count of each fixed-size allocator
 	void InitializeMerge(ARTFlags &flags);
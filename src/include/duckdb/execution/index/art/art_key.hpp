@@ -51,6 +51,9 @@ public:
 		key.len = sizeof(element);
 	}
 
+	//! Creates the key of a (non-NULL) value of a key column with the given physical type
+	static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value);
+
 public:
 	data_t &operator[](size_t i) {
 		return data[i];
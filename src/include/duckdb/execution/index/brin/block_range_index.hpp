@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/brin/block_range_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/index.hpp"
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+#include "duckdb/execution/index/index_type.hpp"
+
+namespace duckdb {
+
+class DataTable;
+struct BlockRangeSummary;
+struct RowIdRange;
+
+//! A block range index (BRIN) summarizes the keys of each range of consecutive row IDs by their smallest and largest
+//! key, and by a bitmap of their hashes. A scan returns the row ID ranges that can contain matching keys, to which a
+//! table scan is restricted. The index is lossy and orders of magnitude smaller than an ART, but it is only selective
+//! if the keys correlate with the row order, e.g., the timestamps of an append-mostly time-series table. Deleting rows
+//! does not shrink the summaries of their ranges
+class BlockRangeIndex : public Index {
+public:
+	// Index type name for the BRIN
+	static constexpr const char *TYPE_NAME = "BRIN";
+	//! The default number of row IDs that each range covers
+	static constexpr idx_t DEFAULT_ROWS_PER_RANGE = STANDARD_VECTOR_SIZE;
+	//! The maximum size of a key, all keys are fixed-size
+	static constexpr idx_t MAX_KEY_SIZE = 16;
+
+public:
+	//! Constructs a BRIN, the option "rows_per_range" sets the number of row IDs that each range covers
+	BlockRangeIndex(const string &name, const IndexConstraintType index_constraint_type,
+	                const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+	                const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+	                const case_insensitive_map_t<Value> &options, const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! The number of row IDs that each range covers
+	idx_t rows_per_range;
+	//! The size of the keys
+	idx_t key_size;
+	//! Fixed-size allocator holding the summaries of the ranges
+	unique_ptr<FixedSizeAllocator> allocator;
+	//! The summaries of all ranges in row ID order, each summary also points to the next one
+	vector<IndexPointer> summaries;
+
+public:
+	//! Create a index instance of this type
+	static unique_ptr<Index> Create(CreateIndexInput &input) {
+		auto brin = make_uniq<BlockRangeIndex>(input.name, input.constraint_type, input.column_ids,
+		                                       input.table_io_manager, input.unbound_expressions, input.db,
+		                                       input.options, input.storage_info);
+		return std::move(brin);
+	}
+
+	//! Try to initialize a scan on the index with the given key expression and filters
+	unique_ptr<IndexScanState> TryInitializeScan(const Expression &index_expr,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
+	//! Fetches the sorted and disjoint row ID ranges that can contain matching keys, adjacent ranges are merged
+	void Scan(DataTable &table, IndexScanState &state, vector<RowIdRange> &result_ranges);
+
+	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
+	ErrorData Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! A BRIN does not enforce any constraints
+	void VerifyAppend(DataChunk &chunk) override;
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+	//! Deletes all data from the index. The lock obtained from InitializeLock must be held
+	void CommitDrop(IndexLock &index_lock) override;
+	//! Deleted rows remain part of the summaries. The lock obtained from InitializeLock must be held
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! Insert a chunk of entries into the index
+	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
+
+	//! Returns all BRIN storage information for serialization
+	IndexStorageInfo GetStorageInfo(const bool get_buffers) override;
+	//! Merge another index into this index. The lock obtained from InitializeLock must be held, and the other
+	//! index must also be locked during the merge
+	bool MergeIndexes(IndexLock &state, Index &other_index) override;
+	//! Summaries are never freed, so there is nothing to vacuum
+	void Vacuum(IndexLock &state) override;
+	//! Returns the in-memory usage of the index. The lock obtained from InitializeLock must be held
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Unpins the on-disk buffers that previous operations read
+	void UnpinBuffers() override;
+
+	//! Returns the string representation of the BRIN, or only verifies the index
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+
+private:
+	//! Returns the summary of a range, creating the summaries of all ranges up to it
+	BlockRangeSummary &GetOrCreateSummary(idx_t range_idx);
+	//! Widens the summary of a range by a key
+	void AddKey(BlockRangeSummary &summary, const_data_ptr_t key) const;
+
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+};
+
+} // namespace duckdb
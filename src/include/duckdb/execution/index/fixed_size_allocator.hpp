@@ -10,6 +10,7 @@
 
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -50,6 +51,9 @@ public:
 
 	//! Resets the allocator, e.g., during 'DELETE FROM table'
 	void Reset();
+	//! Unpins all on-disk buffers that were pinned (read) since the last call, so that the buffer manager can evict
+	//! them. No pointer to a segment of these buffers must be in use
+	void UnpinBuffers();
 
 	//! Returns the in-memory size in bytes
 	idx_t GetInMemorySize() const;
@@ -107,6 +111,10 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! Lock held while pinning a buffer that is not in memory
+	mutex pin_lock;
+	//! The buffers pinned since the last UnpinBuffers
+	vector<idx_t> pinned_buffers;
 
 private:
 	//! Returns the data_ptr_t to a segment, and sets the dirty flag of the buffer containing that segment
@@ -114,11 +122,16 @@ private:
 		D_ASSERT(ptr.GetOffset() < available_segments_per_buffer);
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
+		if (!buffer.InMemory()) {
+			PinBuffer(ptr.GetBufferId(), buffer);
+		}
 		auto buffer_ptr = buffer.Get(dirty);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
 	//! Returns an available buffer id
 	idx_t GetAvailableBufferId() const;
+	//! Pins a buffer that is not in memory. Concurrent lookups can pin the same buffer, only one of them pins it
+	void PinBuffer(const idx_t buffer_id, FixedSizeBuffer &buffer);
 };
 
 } // namespace duckdb
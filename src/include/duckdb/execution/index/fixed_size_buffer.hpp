@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -32,7 +33,8 @@ public:
 
 //! A fixed-size buffer holds fixed-size segments of data. It lazily deserializes a buffer, if on-disk and not
 //! yet in memory, and it only serializes dirty and non-written buffers to disk during
-//! serialization.
+//! serialization. Lookups read an on-disk buffer directly from its (evictable) block, only changes copy it into
+//! a new in-memory buffer.
 class FixedSizeBuffer {
 public:
 	//! Constants for fast offset calculations in the bitmask
@@ -45,6 +47,7 @@ public:
 	//! Constructor for deserializing buffer metadata from disk
 	FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
 	                const BlockPointer &block_pointer);
+	FixedSizeBuffer(FixedSizeBuffer &&other) noexcept;
 
 	//! Block manager of the database instance
 	BlockManager &block_manager;
@@ -63,22 +66,29 @@ public:
 	BlockPointer block_pointer;
 
 public:
-	//! Returns true, if the buffer is in-memory
+	//! Returns true, if the buffer is in-memory. Concurrent lookups can pin the buffer, the buffer handle is only
+	//! valid to read once this returns true
 	inline bool InMemory() const {
-		return buffer_handle.IsValid();
+		return in_memory.load(std::memory_order_acquire);
 	}
 	//! Returns true, if the block is on-disk
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
-	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
+	//! Returns a pointer to the buffer in memory, and pins the buffer, if it is not in memory
 	inline data_ptr_t Get(const bool dirty_p = true) {
 		if (!InMemory()) {
 			Pin();
 		}
 		if (dirty_p) {
+			if (OnDisk()) {
+				CopyOnWrite();
+			}
 			dirty = dirty_p;
 		}
+		if (OnDisk()) {
+			return buffer_handle.Ptr() + block_pointer.offset;
+		}
 		return buffer_handle.Ptr();
 	}
 	//! Destroys the in-memory buffer and the on-disk block
@@ -88,6 +98,8 @@ public:
 	               const idx_t bitmask_offset);
 	//! Pin a buffer (if not in-memory)
 	void Pin();
+	//! Unpin a buffer, the buffer manager can then evict it until it is pinned again
+	void Unpin();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
@@ -98,8 +110,12 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! Set after the buffer handle is pinned, and reset when it is released
+	atomic<bool> in_memory;
 
 private:
+	//! Copies the (partial) data of a pinned on-disk buffer into a new (not yet disk-backed) buffer before it changes
+	void CopyOnWrite();
 	//! Returns the maximum non-free offset in a bitmask
 	uint32_t GetMaxOffset(const idx_t available_segments_per_buffer);
 	//! Sets all uninitialized regions of a buffer in the respective partial block allocation
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/index_scan_range.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! A range of values of an indexed expression. A NULL bound does not restrict the range
+struct IndexScanRange {
+	Value low;
+	Value high;
+	bool low_inclusive = true;
+	bool high_inclusive = true;
+
+	bool IsPoint() const;
+	bool IsEmpty() const;
+
+	//! Returns whether the filters restrict the values of the indexed expression, and if so, the sorted and
+	//! non-overlapping ranges of values that satisfy all of them. Supported filters are comparisons with constants,
+	//! BETWEEN, IN lists, and conjunctions and disjunctions of them
+	static bool ExtractRanges(const Expression &index_expr, const vector<unique_ptr<Expression>> &filter_exprs,
+	                          vector<IndexScanRange> &ranges);
+};
+
+} // namespace duckdb
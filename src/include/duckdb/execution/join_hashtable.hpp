@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/join_hashtable_layout.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -55,6 +56,11 @@ private:
    [POINTER]
    [POINTER]
    The pointers are either NULL
+   With the LINEAR_PROBING layout, the upper 16 bits of every entry of the hash map hold the upper 16 bits of the hash
+   (the "salt") of the rows in the chain that the entry points to. Rows whose salt differs from the salt of the slot
+   they map to are placed in the next free slot (or the next slot with their salt), so that a probe only follows a
+   chain if the salts match.
+   [SALT|POINTER]
 */
 class JoinHashTable {
 public:
@@ -195,6 +201,8 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! The layout of the hash map (CHAINED or LINEAR_PROBING)
+	JoinHashTableLayout pointer_table_layout;
 
 	struct {
 		mutex mj_lock;
@@ -221,6 +229,10 @@ private:
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Find the chains of the hashes of the probe keys, and initialize the pointers of the scan structure with them
+	void InitializePointers(Vector &hashes, const SelectionVector *&current_sel, ScanStructure &ss);
+	//! Find the chains in a LINEAR_PROBING hash map
+	void FindSaltedChains(Vector &hashes, const SelectionVector &sel, ScanStructure &ss);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -248,6 +260,34 @@ public:
 	// External Join
 	//===--------------------------------------------------------------------===//
 	static constexpr const idx_t INITIAL_RADIX_BITS = 4;
+	//! One in every HEAVY_HITTER_SAMPLE_RATE build-side hashes is added to the heavy hitter sketch
+	static constexpr const idx_t HEAVY_HITTER_SAMPLE_RATE = 16;
+
+	//! Space-saving sketch over a sample of the build-side hashes, used to find keys that occur so often that
+	//! repartitioning cannot split up the partition that they are in
+	struct HeavyHitterSketch {
+	public:
+		static constexpr const idx_t CAPACITY = 32;
+
+		//! Add a sampled hash to the sketch
+		void Add(hash_t hash, idx_t count = 1);
+		//! Add the counters of another sketch to this sketch
+		void Combine(const HeavyHitterSketch &other);
+		//! Whether the counter at the given index is (very likely) a heavy hitter
+		bool IsHeavyHitter(idx_t counter_idx) const {
+			return counters[counter_idx].second * CAPACITY > sample_count;
+		}
+		//! The estimated number of build-side rows of the counter at the given index
+		idx_t EstimatedCount(idx_t counter_idx) const {
+			return counters[counter_idx].second * HEAVY_HITTER_SAMPLE_RATE;
+		}
+
+	public:
+		//! The sampled hashes and their (over-)estimated number of occurrences in the sample
+		vector<pair<hash_t, idx_t>> counters;
+		//! The number of sampled hashes
+		idx_t sample_count = 0;
+	};
 
 	struct ProbeSpillLocalAppendState {
 		//! Local partition and append state (if partitioned)
@@ -306,6 +346,12 @@ public:
 		return partition_end;
 	}
 
+	//! The bits of a LINEAR_PROBING hash map entry that hold the salt, and the bits that hold the pointer
+	static constexpr const hash_t SALT_MASK = 0xFFFF000000000000;
+	static constexpr const hash_t POINTER_MASK = 0x0000FFFFFFFFFFFF;
+	//! The estimated build size (in tuples) from which the planner picks the LINEAR_PROBING layout
+	static constexpr const idx_t LINEAR_PROBING_THRESHOLD = 65536;
+
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
 	static idx_t PointerTableCapacity(idx_t count) {
@@ -323,8 +369,10 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize();
-	//! Sets number of radix bits according to the max ht size
-	void SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
+	//! Sets number of radix bits according to the max ht size, taking into account that heavy hitter keys cannot be
+	//! split up. Returns false (and leaves the radix bits alone) if repartitioning would barely shrink the largest
+	//! partition because it is dominated by heavy hitter keys
+	bool SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
 	                             const idx_t max_partition_size, const idx_t max_partition_count);
 	//! Partition this HT
 	void Repartition(JoinHashTable &global_ht);
@@ -345,6 +393,11 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+
+	//! Sketch of the most frequent build-side hashes
+	HeavyHitterSketch heavy_hitters;
+	//! The offset of the next sampled row in the next chunk that is built
+	idx_t heavy_hitter_sample_offset;
 };
 
 } // namespace duckdb
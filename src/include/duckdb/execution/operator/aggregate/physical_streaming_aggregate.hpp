@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by and aggregation on input that is ordered on the groups. Rows with
+//! the same groups arrive consecutively, so a group is emitted as soon as the groups change, and only the aggregate
+//! states of a single chunk are kept
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	//! Whether the aggregates can be computed by a streaming aggregate
+	static bool CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates);
+
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	//! The input has to be processed in order, by a single thread
+	bool ParallelOperator() const override {
+		return false;
+	}
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
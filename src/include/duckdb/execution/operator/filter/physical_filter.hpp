@@ -34,6 +34,7 @@ public:
 	}
 
 	string ParamsToString() const override;
+	bool Equals(const PhysicalOperator &other) const override;
 
 protected:
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
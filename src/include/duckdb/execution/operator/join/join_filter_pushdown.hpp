@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/join_filter_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+class PhysicalHashJoin;
+
+struct JoinFilterPushdownColumn {
+	//! The join condition the filter is derived from
+	idx_t join_condition;
+	//! The column (index into the column ids of the probe-side table scan) the filter is pushed into
+	idx_t probe_column_index;
+	//! Whether or not a min/max filter is pushed
+	bool min_max;
+	//! Whether or not a bloom filter is pushed
+	bool bloom_filter;
+};
+
+//! Min/max statistics and bloom filters of the build-side join keys, one entry per pushed column
+struct JoinFilterState {
+	vector<unique_ptr<BaseStatistics>> min_max;
+	vector<unique_ptr<BloomFilter>> bloom_filters;
+};
+
+struct JoinFilterGlobalState : public JoinFilterState {
+	mutex lock;
+};
+
+struct JoinFilterLocalState : public JoinFilterState {};
+
+//! JoinFilterPushdownInfo describes the filters a hash join derives from the keys of its build side, and pushes into
+//! the table scan on its probe side once the build side is finished
+class JoinFilterPushdownInfo {
+public:
+	JoinFilterPushdownInfo(shared_ptr<DynamicTableFilterSet> dynamic_filters, idx_t bloom_filter_bit_count);
+
+	//! The columns that filters are pushed into
+	vector<JoinFilterPushdownColumn> filters;
+	//! The dynamic filters of the probe-side table scan
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The size of the bloom filters
+	idx_t bloom_filter_bit_count;
+
+public:
+	//! Creates the global state, and removes the filters pushed by a previous execution of the join
+	unique_ptr<JoinFilterGlobalState> GetGlobalState(const PhysicalHashJoin &op) const;
+	unique_ptr<JoinFilterLocalState> GetLocalState(const PhysicalHashJoin &op) const;
+
+	void Sink(DataChunk &join_keys, JoinFilterLocalState &lstate) const;
+	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
+	//! Push the filters into the probe-side table scan
+	void PushFilters(const PhysicalHashJoin &op, JoinFilterGlobalState &gstate, idx_t build_count) const;
+
+private:
+	void InitializeState(const PhysicalHashJoin &op, JoinFilterState &state) const;
+};
+
+} // namespace duckdb
@@ -31,7 +31,8 @@ struct PerfectHashJoinStats {
 	idx_t estimated_cardinality = 0;
 };
 
-//! PhysicalHashJoin represents a hash loop join between two tables
+//! PerfectHashJoinExecutor joins on a single integral key within a small range by directly indexing the build side.
+//! INNER joins store the build columns in key order, SEMI, ANTI and MARK joins only need a bitmap of the build keys.
 class PerfectHashJoinExecutor {
 	using PerfectHashTable = vector<Vector>;
 	using IndexMapping = unordered_map<idx_t, idx_t>;
@@ -42,12 +43,35 @@ public:
 public:
 	bool CanDoPerfectHashJoin();
 
-	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
+	//! Whether the given join type can be executed as a perfect hash join
+	static bool SupportsJoinType(JoinType join_type);
+
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context, const PhysicalHashJoin &probe_op);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state, const uint8_t *build_uuid);
 	bool BuildPerfectHashTable(LogicalType &type);
 
 private:
+	//! Whether the join outputs the build columns (i.e., whether we need more than the bitmap)
+	bool HasBuildPayload() const;
+	inline void SetBuildKey(idx_t idx) {
+		bitmap_build_idx[idx / BITS_PER_ENTRY] |= idx_t(1) << (idx % BITS_PER_ENTRY);
+	}
+	inline bool HasBuildKey(idx_t idx) const {
+		return bitmap_build_idx[idx / BITS_PER_ENTRY] & (idx_t(1) << (idx % BITS_PER_ENTRY));
+	}
+
+	OperatorResultType ProbeUniqueKeys(ExecutionContext &context, DataChunk &input, DataChunk &result,
+	                                   OperatorState &state, const uint8_t *build_uuid);
+	OperatorResultType ProbeDuplicateKeys(ExecutionContext &context, DataChunk &input, DataChunk &result,
+	                                      OperatorState &state, const uint8_t *build_uuid);
+	OperatorResultType ProbeBitmap(DataChunk &input, DataChunk &result, OperatorState &state);
+	//! Fills the build columns of the result with the build rows at the given positions
+	void GatherBuildColumns(DataChunk &input, DataChunk &result, const SelectionVector &build_sel, idx_t count);
+	void CheckJoinPolicy(ExecutionContext &context, DataChunk &input, DataChunk &result,
+	                     const SelectionVector &probe_sel, const SelectionVector &build_sel, idx_t count,
+	                     const uint8_t *build_uuid);
+
 	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
 	                                    idx_t count, idx_t &probe_sel_count);
 	template <typename T>
@@ -55,11 +79,16 @@ private:
 	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
 
 	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
+	                                    idx_t count, idx_t &sel_count);
 	template <typename T>
 	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
+	                                       idx_t count, idx_t &sel_count);
 	bool FullScanHashTable(LogicalType &key_type);
+	//! Groups the build rows by key: afterwards, the rows of key k are at [build_offsets[k], build_offsets[k + 1])
+	void GroupDuplicateKeys(SelectionVector &sel_build, idx_t count);
+
+private:
+	static constexpr const idx_t BITS_PER_ENTRY = sizeof(idx_t) * 8;
 
 private:
 	const PhysicalHashJoin &join;
@@ -68,8 +97,12 @@ private:
 	PerfectHashTable perfect_hash_table;
 	//! Build and probe statistics
 	PerfectHashJoinStats perfect_join_statistics;
-	//! Stores the occurences of each value in the build side
-	unsafe_unique_array<bool> bitmap_build_idx;
+	//! Bitmap that stores the occurences of each value in the build side
+	unsafe_unique_array<idx_t> bitmap_build_idx;
+	//! Whether the build side has duplicate keys
+	bool has_duplicate_keys = false;
+	//! For INNER joins with duplicate keys: the offset of the build rows of each key
+	unsafe_unique_array<idx_t> build_offsets;
 	//!Stores the number of keys in the build side
 	idx_t key_count = 0;
 	//! Stores the number of unique keys in the build side
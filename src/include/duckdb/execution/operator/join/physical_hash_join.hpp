@@ -10,6 +10,7 @@
 
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/execution/join_hashtable.hpp"
+#include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -17,6 +18,17 @@
 
 namespace duckdb {
 
+class PhysicalHashJoin;
+
+//! A hash table that is built once and probed by all hash joins with an identical build side
+struct SharedHashJoinBuild {
+	//! The join that builds the hash table (i.e., the first of the joins for which pipelines are built)
+	optional_ptr<PhysicalHashJoin> build_op;
+	//! Set when the hash table does not fit in the memory reservation of the building join. Every join then builds
+	//! a hash table of its own, which can go external
+	bool unshared = false;
+};
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
@@ -51,10 +63,21 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The layout of the pointer table of the hash table
+	JoinHashTableLayout ht_layout = JoinHashTableLayout::CHAINED;
+	//! The filters pushed into the probe-side table scan (if any)
+	unique_ptr<JoinFilterPushdownInfo> filter_pushdown;
+	//! The hash table shared with other joins with an identical build side (if any)
+	shared_ptr<SharedHashJoinBuild> shared_build;
 
 public:
 	string ParamsToString() const override;
 
+	//! The sink state with the hash table that this join probes, which is owned by another join if the build is shared
+	GlobalSinkState &GetBuildSinkState() const;
+	//! Whether this join probes the hash table that another join built
+	bool ProbesSharedBuild() const;
+
 public:
 	// Operator Interface
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
@@ -101,6 +124,9 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
 };
 
 } // namespace duckdb
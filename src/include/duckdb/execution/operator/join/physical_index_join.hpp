@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/joinside.hpp"
+
+namespace duckdb {
+
+class ART;
+class DuckTableEntry;
+class PhysicalTableScan;
+
+//! PhysicalIndexJoin joins a (small) input against a base table by probing an ART index on the join key of the table
+//! for every input row, and fetching the matching rows from the table. Unlike a hash join, the table is never scanned.
+class PhysicalIndexJoin : public CachingPhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+	//! A probe and fetch of a single row costs roughly as much as scanning and hashing this many rows of the table
+	static constexpr const idx_t INDEX_JOIN_COST_FACTOR = 100;
+
+public:
+	PhysicalIndexJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> probe, PhysicalTableScan &scan,
+	                  JoinCondition condition, bool lhs_first, ART &index, const vector<idx_t> &left_projection_map,
+	                  const vector<idx_t> &right_projection_map, idx_t estimated_cardinality);
+
+	//! The table that is probed
+	DuckTableEntry &table;
+	//! The index on the join key of the table
+	ART &index;
+	//! The join key of the probe side
+	unique_ptr<Expression> probe_key;
+	//! Whether the probe side produces the leftmost output columns
+	bool lhs_first;
+	//! The columns of the probe side that are projected into the output
+	vector<idx_t> probe_projection;
+	//! The storage columns that are fetched from the table (followed by the row id) and their types
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+
+public:
+	//! Whether the equi-join "op" can probe "index" of the table scanned by "scan" instead of building a hash table:
+	//! the join key of the scan side must be exactly the key column of a single-column ART, and the scan must not
+	//! filter its rows
+	static optional_ptr<ART> FindJoinIndex(ClientContext &context, PhysicalOperator &scan, const Expression &key);
+
+	string ParamsToString() const override;
+
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::NO_ORDER;
+	}
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+private:
+	//! Looks up the keys of an input chunk in the index, in sorted key order
+	void ProbeIndex(ExecutionContext &context, DataChunk &input, OperatorState &state) const;
+	//! Collects the keys of the transaction-local rows of the table, which are not part of the index
+	void InitializeLocalRows(ExecutionContext &context, OperatorState &state) const;
+};
+
+} // namespace duckdb
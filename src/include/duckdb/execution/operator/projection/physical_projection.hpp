@@ -33,6 +33,7 @@ public:
 	}
 
 	string ParamsToString() const override;
+	bool Equals(const PhysicalOperator &other) const override;
 
 	static unique_ptr<PhysicalOperator>
 	CreateJoinProjection(vector<LogicalType> proj_types, const vector<LogicalType> &lhs_types,
@@ -44,6 +44,8 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! The filters pushed into the scan at runtime (e.g., by a hash join), if any
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
 
@@ -19,7 +19,10 @@
 namespace duckdb {
 class DuckTableEntry;
 
-//! Physical CREATE (UNIQUE) INDEX statement
+//! Physical CREATE (UNIQUE) INDEX statement. The keys are collected by all threads in buffer-managed collections, and
+//! range partitioned by their first distinct byte, with splitters chosen from a sample of the keys. The ARTs of each
+//! partition are then constructed from its sorted keys in parallel, and the disjoint subtrees are stitched together
+//! below a single root node
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
@@ -27,7 +30,7 @@ public:
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
 	                       unique_ptr<CreateIndexInfo> info, vector<unique_ptr<Expression>> unbound_expressions,
-	                       idx_t estimated_cardinality, const bool sorted);
+	                       idx_t estimated_cardinality);
 
 	//! The table to create the index for
 	DuckTableEntry &table;
@@ -37,8 +40,6 @@ public:
 	unique_ptr<CreateIndexInfo> info;
 	//! Unbound expressions to be used in the optimizer
 	vector<unique_ptr<Expression>> unbound_expressions;
-	//! Whether the pipeline sorts the data prior to index creation
-	const bool sorted;
 
 public:
 	//! Source interface, NOP for this operator
@@ -54,11 +55,6 @@ public:
 	//! Sink interface, global sink state
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
 
-	//! Sink for unsorted data: insert iteratively
-	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
-	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -70,5 +66,11 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+public:
+	//! Creates an empty ART with the definition of the index
+	unique_ptr<ART> CreateART() const;
+	//! Adds the constructed global index to the table and creates its catalog entry
+	void AddIndex(ClientContext &context, GlobalSinkState &gstate) const;
 };
 } // namespace duckdb
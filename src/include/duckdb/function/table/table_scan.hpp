@@ -15,6 +15,7 @@
 namespace duckdb {
 class DuckTableEntry;
 class TableCatalogEntry;
+struct IndexScanState;
 
 struct TableScanBindData : public TableFunctionData {
 	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
@@ -27,13 +28,15 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_index_scan;
 	//! Whether or not the table scan is for index creation
 	bool is_create_index;
-	//! The row ids to fetch (in case of an index scan)
-	vector<row_t> result_ids;
+	//! The index and the key ranges to scan it for (in case of an index scan), the row ids are only fetched when the
+	//! scan is initialized
+	string index_name;
+	shared_ptr<IndexScanState> index_state;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && result_ids == other.result_ids;
+		return &other.table == &table && index_name == other.index_name && index_state == other.index_state;
 	}
 };
 
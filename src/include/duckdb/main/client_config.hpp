@@ -10,6 +10,7 @@
 
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/join_hashtable_layout.hpp"
 #include "duckdb/common/enums/output_type.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -79,6 +80,16 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! The minimum number of rows on both sides of an equi-join to use a merge join instead of a hash join (0: never)
+	idx_t merge_join_threshold = 0;
+	//! Use index joins for equi-joins on an indexed column, even if the other side is not small
+	bool prefer_index_joins = false;
+	//! The layout of the pointer table used by hash joins (AUTOMATIC lets the planner decide)
+	JoinHashTableLayout hash_join_layout = JoinHashTableLayout::AUTOMATIC;
+	//! The scheduling priority of queries of this connection, tasks of higher priority queries are executed first
+	int64_t query_priority = 0;
+	//! The share of the threads that queries of this connection receive relative to queries with the same priority
+	idx_t query_weight = 1;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
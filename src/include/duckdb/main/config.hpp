@@ -12,6 +12,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -120,6 +121,8 @@ struct DBConfigOptions {
 	string autoinstall_extension_repo = "";
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = (idx_t)-1;
+	//! The policy used to select buffers for eviction
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = (idx_t)-1;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -191,6 +194,16 @@ struct DBConfigOptions {
 	static bool debug_print_bindings; // NOLINT: debug setting
 	//! The peak allocation threshold at which to flush the allocator after completing a task (1 << 27, ~128MB)
 	idx_t allocator_flush_threshold = 134217728;
+	//! Whether tasks scheduled by a worker thread are queued on that thread and stolen by idle threads
+	bool enable_work_stealing = false;
+	//! Whether worker threads are bound to NUMA nodes, and buffers and row groups are kept on a node
+	bool enable_numa_awareness = false;
+	//! The maximum number of memory-intensive queries that are admitted concurrently (0 = no limit)
+	idx_t max_memory_intensive_queries = 0;
+	//! The maximum fraction of the rows of a table that an index scan may return (beyond index_scan_max_count)
+	double index_scan_percentage = 0.001;
+	//! The number of rows that an index scan may always return
+	idx_t index_scan_max_count = STANDARD_VECTOR_SIZE;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -62,6 +62,16 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to select buffers for eviction (LRU or 2Q, which protects frequently used buffers from scans)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -130,6 +140,37 @@ struct PreferRangeJoins {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MergeJoinThreshold {
+	static constexpr const char *Name = "merge_join_threshold";
+	static constexpr const char *Description =
+	    "The minimum number of rows on both sides of an equi-join to use a merge join instead of a hash join (0 to "
+	    "disable merge joins)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct PreferIndexJoins {
+	static constexpr const char *Name = "prefer_index_joins";
+	static constexpr const char *Description =
+	    "Use index joins for equi-joins on an indexed table column, regardless of the size of the other side";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct HashJoinLayoutSetting {
+	static constexpr const char *Name = "hash_join_layout";
+	static constexpr const char *Description =
+	    "The layout of the hash join pointer table (automatic, chained or linear_probing)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugWindowMode {
 	static constexpr const char *Name = "debug_window_mode";
 	static constexpr const char *Description = "DEBUG SETTING: switch window mode to use";
@@ -643,6 +684,77 @@ struct FlushAllocatorSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WorkStealingSetting {
+	static constexpr const char *Name = "enable_work_stealing";
+	static constexpr const char *Description =
+	    "Whether tasks scheduled by a worker thread are queued locally on that thread and stolen by idle threads";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct NumaAwarenessSetting {
+	static constexpr const char *Name = "enable_numa_awareness";
+	static constexpr const char *Description =
+	    "Bind worker threads to NUMA nodes, keep buffers on the node that allocated them and scan row groups on a "
+	    "fixed node";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "The scheduling priority of queries of this connection, tasks of higher priority queries are executed first";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryWeightSetting {
+	static constexpr const char *Name = "query_weight";
+	static constexpr const char *Description =
+	    "The share of the threads that queries of this connection receive relative to queries of the same priority";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct MaxMemoryIntensiveQueriesSetting {
+	static constexpr const char *Name = "max_memory_intensive_queries";
+	static constexpr const char *Description =
+	    "The maximum number of memory-intensive queries that run concurrently, other queries wait (0 = no limit)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct IndexScanPercentageSetting {
+	static constexpr const char *Name = "index_scan_percentage";
+	static constexpr const char *Description =
+	    "The maximum fraction of the rows of a table that an index scan may return, beyond index_scan_max_count";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct IndexScanMaxCountSetting {
+	static constexpr const char *Name = "index_scan_max_count";
+	static constexpr const char *Description =
+	    "The number of rows that an index scan may always return, regardless of the size of the table";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
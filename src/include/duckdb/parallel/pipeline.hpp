@@ -52,6 +52,8 @@ public:
 	reference_map_t<const PhysicalOperator, reference<Pipeline>> delim_join_dependencies;
 	//! Materialized CTE scan dependencies
 	reference_map_t<const PhysicalOperator, reference<Pipeline>> cte_dependencies;
+	//! Hash joins that build a hash table that is shared with other hash joins, and the pipeline that builds it
+	reference_map_t<const PhysicalOperator, reference<Pipeline>> shared_hash_join_builds;
 
 public:
 	void SetPipelineSource(Pipeline &pipeline, PhysicalOperator &op);
@@ -13,6 +13,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 
@@ -23,18 +24,23 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerQueue;
+
+typedef vector<shared_ptr<QueueProducerToken>> producer_list_t;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, shared_ptr<QueueProducerToken> token);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
-	unique_ptr<QueueProducerToken> token;
-	mutex producer_lock;
+	//! The queue state of the producer, shared with the scheduler so it can be read without holding a lock
+	shared_ptr<QueueProducerToken> token;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
@@ -45,7 +51,8 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer, "priority" and "weight" determine how its tasks are scheduled relative to other producers
+	unique_ptr<ProducerToken> CreateProducer(int64_t priority = 0, idx_t weight = 1);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -76,9 +83,31 @@ public:
 
 	//! Set the allocator flush threshold
 	void SetAllocatorFlushTreshold(idx_t threshold);
+	//! Enable or disable scheduling tasks on the local queue of the worker thread that scheduled them
+	void SetWorkStealing(bool enable);
+	//! Enable or disable binding the background threads to NUMA nodes (takes effect when the threads are relaunched)
+	void SetNumaAwareness(bool enable);
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Run tasks on a background worker thread until "marker" is set to false
+	void ExecuteForever(atomic<bool> *marker, WorkerQueue &worker);
+	//! Fetches a task from the local queue of the worker or - if that is empty - steals from other workers
+	bool GetTaskForWorker(WorkerQueue &worker, shared_ptr<Task> &task);
+	//! Fetches a task from the shared queue (or, with fair share scheduling, from wherever the next task is)
+	bool DequeueTask(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker = nullptr);
+	//! Fetches a task of the producer with the highest priority that is furthest behind its share (stride scheduling)
+	bool DequeueFairShare(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker);
+	//! Returns the current list of producers, worker threads keep a copy that is only refreshed when it changed
+	shared_ptr<const producer_list_t> GetProducers(optional_ptr<WorkerQueue> worker);
+	//! Removes a producer from the fair share state (called by the destructor of ProducerToken)
+	void UnregisterProducer(ProducerToken &token);
+	//! Steals a task scheduled by "token" from the local queue of any worker
+	bool StealTaskFromProducer(QueueProducerToken &token, shared_ptr<Task> &task);
+	//! Steals a single task from the local queue of any worker
+	bool StealTask(shared_ptr<Task> &task);
+	//! Steals half of the tasks from the local queue of another worker, the first stolen task is returned
+	bool StealTasks(WorkerQueue &worker, shared_ptr<Task> &task);
 
 private:
 	DatabaseInstance &db;
@@ -90,6 +119,25 @@ private:
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! Lock for accessing the worker queues
+	mutex worker_lock;
+	//! The local task queues of the background threads, the i-th thread uses the i-th queue
+	vector<unique_ptr<WorkerQueue>> worker_queues;
+	//! Whether tasks scheduled by a background thread are placed in the local queue of that thread
+	atomic<bool> work_stealing;
+	//! Whether background threads should be bound to NUMA nodes
+	atomic<bool> numa_aware;
+	//! Whether the running background threads are bound to NUMA nodes (must hold the thread lock)
+	bool threads_bound;
+	//! Lock for registering and unregistering producers
+	mutex fair_share_lock;
+	//! All producers, sorted by descending priority. The list is replaced (never modified), so copies can be read
+	//! without holding the lock
+	shared_ptr<const producer_list_t> producers;
+	//! Incremented whenever the list of producers is replaced
+	atomic<idx_t> producers_version;
+	//! The number of producers with a non-default priority or weight, if zero tasks are dequeued in any order
+	atomic<idx_t> weighted_producers;
 	//! The threshold after which to flush the allocator after completing a task
 	atomic<idx_t> allocator_flush_threshold;
 	//! Requested thread count (set by the 'threads' setting)
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! BloomFilter is a (register-blocked) bloom filter over the hashes of a set of values. A row passes the filter if its
+//! value might be contained in the set. NULL values never pass the filter.
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The bounds of the filter size
+	static constexpr const idx_t MINIMUM_BIT_COUNT = 1ULL << 12ULL;
+	static constexpr const idx_t MAXIMUM_BIT_COUNT = 1ULL << 25ULL;
+	//! The number of bits reserved per inserted value
+	static constexpr const idx_t BITS_PER_VALUE = 16;
+
+public:
+	explicit BloomFilter(idx_t bit_count);
+	explicit BloomFilter(vector<idx_t> bits);
+
+	//! The bits of the filter. The number of blocks is a power of two.
+	vector<idx_t> bits;
+
+public:
+	//! Returns the number of bits for a filter that will hold "cardinality" values
+	static idx_t GetBitCount(idx_t cardinality);
+	idx_t BitCount() const {
+		return bits.size() * 64;
+	}
+	//! Whether or not the filter can hold "count" values with an acceptable false positive rate
+	bool CanHold(idx_t count) const {
+		return count * BITS_PER_VALUE <= BitCount();
+	}
+
+	//! Insert the (non-NULL) values in "keys" into the filter
+	void Insert(Vector &keys, idx_t count);
+	//! OR the bits of another filter of the same size into this one
+	void Merge(const BloomFilter &other);
+	//! Filters the selected rows of "keys", keeping only the rows that might be contained in the filter
+	idx_t Filter(Vector &keys, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! Every hash sets two bits within a single 64-bit block, so a lookup touches a single cache line
+	inline idx_t GetBlock(hash_t hash) const {
+		return (hash >> 32) & (bits.size() - 1);
+	}
+	static inline idx_t GetMask(hash_t hash) {
+		return (idx_t(1) << (hash & 63)) | (idx_t(1) << ((hash >> 6) & 63));
+	}
+};
+
+} // namespace duckdb
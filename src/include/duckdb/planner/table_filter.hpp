@@ -9,12 +9,15 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class BaseStatistics;
+class PhysicalOperator;
 
 enum class TableFilterType : uint8_t {
 	CONSTANT_COMPARISON = 0, // constant comparison (e.g. =C, >C, >=C, <C, <=C)
@@ -22,7 +25,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6 // bloom filter membership (e.g. of the join keys of a hash join build side)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -42,6 +46,7 @@ public:
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type != other.filter_type;
 	}
+	virtual unique_ptr<TableFilter> Copy() const = 0;
 
 	virtual void Serialize(Serializer &serializer) const;
 	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
@@ -100,4 +105,22 @@ public:
 	static TableFilterSet Deserialize(Deserializer &deserializer);
 };
 
+//! DynamicTableFilterSet contains filters that are pushed into a table scan while the query is executing, e.g., the
+//! filters derived from the build side of a hash join
+class DynamicTableFilterSet {
+public:
+	//! Push a filter, replacing any filter previously pushed by the same operator on the same column
+	void PushFilter(const PhysicalOperator &op, idx_t column_index, unique_ptr<TableFilter> filter);
+	//! Remove all filters pushed by an operator
+	void ClearFilters(const PhysicalOperator &op);
+
+	bool HasFilters() const;
+	//! Returns the combination of the dynamic filters and the (static) filters of the table scan
+	unique_ptr<TableFilterSet> GetFinalTableFilters(optional_ptr<TableFilterSet> existing_filters) const;
+
+private:
+	mutable mutex lock;
+	reference_map_t<const PhysicalOperator, unique_ptr<TableFilterSet>> filters;
+};
+
 } // namespace duckdb
@@ -23,6 +23,10 @@ class DatabaseInstance;
 
 enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
 
+//! The eviction queues of the buffer pool. Blocks in the RECENT queue are evicted before blocks in the FREQUENT queue.
+enum class EvictionQueueType : uint8_t { RECENT = 0, FREQUENT = 1 };
+static constexpr const idx_t EVICTION_QUEUE_COUNT = 2;
+
 struct BufferPoolReservation {
 	MemoryTag tag;
 	idx_t size {0};
@@ -123,6 +127,10 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! The number of times the block was unpinned since it was last loaded
+	idx_t unpin_count;
+	//! The eviction queue that holds the latest eviction node of this block
+	EvictionQueueType eviction_queue;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -58,6 +59,12 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy that decides which blocks are evicted first
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+	//! Only re-use the memory of evicted buffers that were allocated on the NUMA node of the evicting thread
+	void SetNumaAwareness(bool enable);
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -72,23 +79,30 @@ protected:
 	virtual EvictionResult EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 
-	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
-	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
+	//! Tries to dequeue an element from the eviction queues, in eviction order.
+	bool TryDequeue(BufferEvictionNode &node, EvictionQueueType &queue_type);
+	//! Tries to dequeue an element from the eviction queues, but only after acquiring the purge queue lock.
+	bool TryDequeueWithLock(BufferEvictionNode &node, EvictionQueueType &queue_type);
+	//! Bulk purge dead nodes from an eviction queue. Then, enqueue those that are still alive.
+	void PurgeIteration(EvictionQueueType queue_type, const idx_t purge_size);
+	//! Garbage collect dead nodes in the eviction queues.
 	void PurgeQueue();
+	//! Garbage collect dead nodes in a single eviction queue.
+	void PurgeQueue(EvictionQueueType queue_type);
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
+	//! Returns the eviction queue a block handle should be added to when it is unpinned
+	EvictionQueueType GetEvictionQueueType(BlockHandle &handle) const;
+	EvictionQueue &GetEvictionQueue(EvictionQueueType queue_type);
 
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
+	//! Increment the dead node counter of an eviction queue.
+	inline void IncrementDeadNodes(EvictionQueueType queue_type) {
+		total_dead_nodes[uint8_t(queue_type)]++;
 	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
+	//! Decrement the dead node counter of an eviction queue.
+	inline void DecrementDeadNodes(EvictionQueueType queue_type) {
+		total_dead_nodes[uint8_t(queue_type)]--;
 	}
 
 protected:
@@ -98,12 +112,22 @@ protected:
 	atomic<idx_t> current_memory;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! Eviction queues, indexed by EvictionQueueType
+	vector<unique_ptr<EvictionQueue>> queues;
+	//! The eviction policy
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Whether evicted buffers are only re-used on the NUMA node they were allocated on
+	atomic<bool> numa_aware;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
+	//! Number of pins per tag that found the block already loaded in memory
+	atomic<idx_t> buffer_hits_per_tag[MEMORY_TAG_COUNT];
+	//! Number of pins per tag that had to load the block
+	atomic<idx_t> buffer_misses_per_tag[MEMORY_TAG_COUNT];
+	//! Number of blocks evicted per tag
+	atomic<idx_t> evictions_per_tag[MEMORY_TAG_COUNT];
 
 	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
 	constexpr static idx_t INSERT_INTERVAL = 4096;
@@ -118,9 +142,9 @@ protected:
 
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
 	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
+	//! Total dead nodes per eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into an eviction queue.
+	atomic<idx_t> total_dead_nodes[EVICTION_QUEUE_COUNT];
 	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
 	//! Only lets a single thread enter the purge phase.
 	mutex purge_lock;
@@ -9,6 +9,12 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins that found the block loaded in memory
+	idx_t buffer_hits;
+	//! The number of pins that had to load the block
+	idx_t buffer_misses;
+	//! The number of blocks that were evicted
+	idx_t evictions;
 };
 
 struct TemporaryFileInformation {
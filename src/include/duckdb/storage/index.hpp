@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/enums/index_constraint_type.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -17,6 +18,8 @@
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -26,9 +29,23 @@ class ConflictManager;
 
 struct IndexLock;
 struct IndexScanState;
+class Index;
+
+//! A shared lock on an index, held by lookups that do not change the index. Lookups holding a shared lock run
+//! concurrently, but never concurrently with a holder of the exclusive lock obtained by Index::InitializeLock
+class IndexSharedLock {
+public:
+	explicit IndexSharedLock(Index &index);
+	~IndexSharedLock();
+
+private:
+	Index &index;
+};
 
 //! The index is an abstract base class that serves as the basis for indexes
 class Index {
+	friend class IndexSharedLock;
+
 public:
 	Index(const string &name, const string &index_type, IndexConstraintType index_constraint_type,
 	      const vector<column_t> &column_ids, TableIOManager &table_io_manager,
@@ -66,6 +83,10 @@ public:
 
 	//! Obtain a lock on the index
 	void InitializeLock(IndexLock &state);
+	//! Called while no lookup or change of the index is in progress: the index can release the memory that it
+	//! only keeps for previous operations, e.g., pins of buffers that the buffer manager could evict
+	virtual void UnpinBuffers() {
+	}
 	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
 	virtual ErrorData Append(IndexLock &state, DataChunk &entries, Vector &row_identifiers) = 0;
 	//! Obtains a lock and calls Append while holding that lock
@@ -141,12 +162,15 @@ public:
 protected:
 	//! Lock used for any changes to the index
 	mutex lock;
+	//! The number of lookups that hold a shared lock on the index
+	idx_t shared_lock_count;
+	//! Protects the shared lock count, and signals holders of the lock when the last lookup finishes
+	mutex shared_lock_mutex;
+	std::condition_variable shared_lock_cv;
 
 private:
 	//! Bound expressions used during expression execution
 	vector<unique_ptr<Expression>> bound_expressions;
-	//! Expression executor to execute the index expressions
-	ExpressionExecutor executor;
 
 	//! Bind the unbound expressions of the index
 	unique_ptr<Expression> BindExpression(unique_ptr<Expression> expr);
@@ -58,6 +58,8 @@ public:
 	static bool InitializeScanInRowGroup(CollectionScanState &state, RowGroupCollection &collection,
 	                                     RowGroup &row_group, idx_t vector_index, idx_t max_row);
 	void InitializeParallelScan(ParallelCollectionScanState &state);
+	//! Split the row groups into one contiguous range per NUMA node, threads scan the range of their own node first
+	void InitializeNumaParallelScan(ParallelCollectionScanState &state, idx_t node_count);
 	bool NextParallelScan(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state);
 
 	bool Scan(DuckTransaction &transaction, const vector<column_t> &column_ids,
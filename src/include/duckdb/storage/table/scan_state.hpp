@@ -109,6 +109,12 @@ struct ColumnFetchState {
 	BufferHandle &GetOrInsertHandle(ColumnSegment &segment);
 };
 
+//! A range of row ids [start, end)
+struct RowIdRange {
+	idx_t start;
+	idx_t end;
+};
+
 class CollectionScanState {
 public:
 	explicit CollectionScanState(TableScanState &parent_p);
@@ -127,6 +133,8 @@ public:
 	idx_t max_row;
 	//! The current batch index
 	idx_t batch_index;
+	//! The sorted and disjoint row id ranges the scan is restricted to (if any)
+	optional_ptr<const vector<RowIdRange>> row_ranges;
 	ClientContext *context;
 	//! The name of the collection/table.
 	std::string name;
@@ -137,6 +145,8 @@ public:
 	TableFilterSet *GetFilters();
 	AdaptiveFilter *GetAdaptiveFilter();
 	TableScanOptions &GetOptions();
+	//! Returns the first row in [row, end) that lies in one of the row ranges, or end if there is none
+	idx_t NextRowInRanges(idx_t row, idx_t end) const;
 	bool Scan(DuckTransaction &transaction, DataChunk &result);
 	bool ScanCommitted(DataChunk &result, TableScanType type);
 	bool ScanCommitted(DataChunk &result, SegmentLock &l, TableScanType type);
@@ -177,6 +187,13 @@ private:
 	unique_ptr<AdaptiveFilter> adaptive_filter;
 };
 
+struct NodeRowGroupRange {
+	//! The index of the next row group to scan
+	idx_t next;
+	//! The end of the range of row group indexes
+	idx_t end;
+};
+
 struct ParallelCollectionScanState {
 	ParallelCollectionScanState();
 
@@ -188,6 +205,8 @@ struct ParallelCollectionScanState {
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
 	mutex lock;
+	//! For NUMA-aware scans, the row groups scanned by the threads on each node (empty otherwise)
+	vector<NodeRowGroupRange> node_ranges;
 };
 
 struct ParallelTableScanState {
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
@@ -19,6 +20,23 @@
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// TemporaryBufferSize
+//===--------------------------------------------------------------------===//
+
+//! The size of the slots in a temporary file. Buffers that compress well are written to files with smaller slots.
+enum class TemporaryBufferSize : uint64_t {
+	INVALID = 0,
+	S32K = 32768,
+	S64K = 65536,
+	S96K = 98304,
+	S128K = 131072,
+	S160K = 163840,
+	S192K = 196608,
+	S224K = 229376,
+	DEFAULT = DEFAULT_BLOCK_ALLOC_SIZE
+};
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
@@ -69,7 +87,8 @@ class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
-	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index);
+	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
+	                    TemporaryBufferSize size);
 
 public:
 	struct TemporaryFileLock {
@@ -82,8 +101,12 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a buffer to the file - if the slots in this file are smaller than a block, the compressed buffer is written
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, data_ptr_t compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	TemporaryBufferSize GetBufferSize() const {
+		return size;
+	}
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -98,6 +121,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of the slots in this file
+	TemporaryBufferSize size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -128,6 +153,9 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+	//! The number of buffers of a memory tag that are written uncompressed after a buffer of that tag did not compress
+	constexpr static idx_t COMPRESSION_RETRY_INTERVAL = 16;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 
@@ -140,13 +168,20 @@ public:
 		lock_guard<mutex> lock;
 	};
 
-	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
+	//! Writes a buffer to a temporary file, returns the size of the slot it was written to
+	idx_t WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
+	//! Reads a buffer back from a temporary file, slot_size is set to the size of the slot it was read from
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer, idx_t &slot_size);
 	void DeleteTemporaryBuffer(block_id_t id);
 	vector<TemporaryFileInformation> GetTemporaryFiles();
 
+	//! Decompresses a buffer that was written to a temporary file with slots smaller than a block
+	static void DecompressBuffer(const_data_ptr_t compressed_buffer, FileBuffer &buffer);
+
 private:
+	//! Tries to compress the buffer into compressed_buffer, returns the slot size the buffer should be written to
+	TemporaryBufferSize CompressBuffer(MemoryTag tag, FileBuffer &buffer, data_ptr_t compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -164,6 +199,8 @@ private:
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
 	//! Manager of in-use temporary file indexes
 	BlockIndexManager index_manager;
+	//! The number of upcoming buffers per memory tag that are written without attempting to compress them
+	atomic<idx_t> compression_skip_count[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
@@ -13,6 +13,8 @@
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class ClientContext;
@@ -51,12 +53,30 @@ private:
 	atomic<idx_t> reservation;
 };
 
+//! Admission of a memory-intensive query, the query counts towards the limit as long as this is within scope
+class TemporaryMemoryAdmission {
+	friend class TemporaryMemoryManager;
+
+private:
+	TemporaryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context);
+
+public:
+	~TemporaryMemoryAdmission();
+
+private:
+	//! The TemporaryMemoryManager that admitted the query
+	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client that runs the query
+	ClientContext &context;
+};
+
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
 //! to concurrent states, such that their combined memory usage does not exceed the limit
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
 	friend class TemporaryMemoryState;
+	friend class TemporaryMemoryAdmission;
 
 public:
 	TemporaryMemoryManager();
@@ -78,8 +98,15 @@ public:
 	static TemporaryMemoryManager &Get(ClientContext &context);
 	//! Register a TemporaryMemoryState
 	unique_ptr<TemporaryMemoryState> Register(ClientContext &context);
+	//! Get the minimum reservation that a TemporaryMemoryState receives
+	idx_t GetMinimumReservation(ClientContext &context);
+	//! Wait until a memory-intensive query can be admitted. At most 'max_memory_intensive_queries' queries are
+	//! admitted at once, and only while the reservations leave room for the minimum reservation of another query
+	unique_ptr<TemporaryMemoryAdmission> Admit(ClientContext &context);
 
 private:
+	//! How long to wait before checking whether a query waiting for admission was interrupted
+	static constexpr const int64_t ADMISSION_TIMEOUT_MS = 10;
 	//! Locks the TemporaryMemoryManager
 	unique_lock<mutex> Lock();
 	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
@@ -92,6 +119,12 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Get the minimum reservation that a TemporaryMemoryState receives (must hold the lock)
+	idx_t GetMinimumReservationInternal() const;
+	//! Whether a memory-intensive query of the client can be admitted (must hold the lock)
+	bool CanAdmit(ClientContext &context) const;
+	//! Release the admission of a query (called by the destructor of TemporaryMemoryAdmission)
+	void Release(TemporaryMemoryAdmission &admission);
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -114,6 +147,13 @@ private:
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
 	idx_t remaining_size;
+
+	//! The maximum number of admitted memory-intensive queries (0 = no limit)
+	idx_t max_admitted_queries;
+	//! Number of admitted memory-intensive queries per client (a client can run nested queries)
+	reference_map_t<ClientContext, idx_t> admitted_queries;
+	//! Signalled when an admitted query is released
+	std::condition_variable admission_cv;
 };
 
 } // namespace duckdb
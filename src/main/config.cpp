@@ -56,12 +56,16 @@ bool DBConfigOptions::debug_print_bindings = false;
 static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_LOCAL(DebugForceExternal),
     DUCKDB_LOCAL(DebugForceNoCrossProduct),
     DUCKDB_LOCAL(DebugAsOfIEJoin),
     DUCKDB_LOCAL(PreferRangeJoins),
+    DUCKDB_LOCAL(MergeJoinThreshold),
+    DUCKDB_LOCAL(PreferIndexJoins),
+    DUCKDB_LOCAL(HashJoinLayoutSetting),
     DUCKDB_GLOBAL(DebugWindowMode),
     DUCKDB_GLOBAL_LOCAL(DefaultCollationSetting),
     DUCKDB_GLOBAL(DefaultOrderSetting),
@@ -122,6 +126,13 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(FlushAllocatorSetting),
+    DUCKDB_GLOBAL(WorkStealingSetting),
+    DUCKDB_GLOBAL(NumaAwarenessSetting),
+    DUCKDB_LOCAL(QueryPrioritySetting),
+    DUCKDB_LOCAL(QueryWeightSetting),
+    DUCKDB_GLOBAL(MaxMemoryIntensiveQueriesSetting),
+    DUCKDB_GLOBAL(IndexScanPercentageSetting),
+    DUCKDB_GLOBAL(IndexScanMaxCountSetting),
     DUCKDB_GLOBAL(DuckDBApiSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
     DUCKDB_LOCAL(PartitionedWriteFlushThreshold),
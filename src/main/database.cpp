@@ -383,6 +383,8 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	} else {
 		config.buffer_pool = make_shared<BufferPool>(config.options.maximum_memory);
 	}
+	config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
+	config.buffer_pool->SetNumaAwareness(config.options.enable_numa_awareness);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
@@ -13,6 +13,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -78,6 +79,43 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option BUFFER_EVICTION_POLICY \"%s\". Expected LRU or 2Q.", parameter);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_eviction_policy) {
+	case BufferEvictionPolicy::LRU:
+		return "lru";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unknown buffer eviction policy setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -238,6 +276,72 @@ Value PreferRangeJoins::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_range_joins);
 }
 
+//===--------------------------------------------------------------------===//
+// Merge Join Threshold
+//===--------------------------------------------------------------------===//
+void MergeJoinThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).merge_join_threshold = ClientConfig().merge_join_threshold;
+}
+
+void MergeJoinThreshold::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).merge_join_threshold = input.GetValue<uint64_t>();
+}
+
+Value MergeJoinThreshold::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).merge_join_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Prefer Index Joins
+//===--------------------------------------------------------------------===//
+void PreferIndexJoins::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).prefer_index_joins = ClientConfig().prefer_index_joins;
+}
+
+void PreferIndexJoins::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).prefer_index_joins = input.GetValue<bool>();
+}
+
+Value PreferIndexJoins::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).prefer_index_joins);
+}
+
+//===--------------------------------------------------------------------===//
+// Hash Join Layout
+//===--------------------------------------------------------------------===//
+void HashJoinLayoutSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).hash_join_layout = ClientConfig().hash_join_layout;
+}
+
+void HashJoinLayoutSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (parameter == "automatic") {
+		config.hash_join_layout = JoinHashTableLayout::AUTOMATIC;
+	} else if (parameter == "chained") {
+		config.hash_join_layout = JoinHashTableLayout::CHAINED;
+	} else if (parameter == "linear_probing") {
+		config.hash_join_layout = JoinHashTableLayout::LINEAR_PROBING;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option HASH_JOIN_LAYOUT \"%s\". Expected AUTOMATIC, CHAINED or LINEAR_PROBING.",
+		    parameter);
+	}
+}
+
+Value HashJoinLayoutSetting::GetSetting(const ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).hash_join_layout) {
+	case JoinHashTableLayout::AUTOMATIC:
+		return "automatic";
+	case JoinHashTableLayout::CHAINED:
+		return "chained";
+	case JoinHashTableLayout::LINEAR_PROBING:
+		return "linear_probing";
+	default:
+		throw InternalException("Unknown hash join layout setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Default Collation
 //===--------------------------------------------------------------------===//
@@ -1354,6 +1458,139 @@ Value FlushAllocatorSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.allocator_flush_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Work Stealing
+//===--------------------------------------------------------------------===//
+void WorkStealingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_work_stealing = input.GetValue<bool>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetWorkStealing(config.options.enable_work_stealing);
+	}
+}
+
+void WorkStealingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_work_stealing = DBConfig().options.enable_work_stealing;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetWorkStealing(config.options.enable_work_stealing);
+	}
+}
+
+Value WorkStealingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_work_stealing);
+}
+
+//===--------------------------------------------------------------------===//
+// NUMA Awareness
+//===--------------------------------------------------------------------===//
+static void SetNumaAwareness(DatabaseInstance *db, DBConfig &config, bool enable) {
+	config.options.enable_numa_awareness = enable;
+	if (db) {
+		// the threads are re-bound the next time they are (re)launched
+		TaskScheduler::GetScheduler(*db).SetNumaAwareness(enable);
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetNumaAwareness(enable);
+	}
+}
+
+void NumaAwarenessSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	SetNumaAwareness(db, config, input.GetValue<bool>());
+}
+
+void NumaAwarenessSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	SetNumaAwareness(db, config, DBConfig().options.enable_numa_awareness);
+}
+
+Value NumaAwarenessSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_numa_awareness);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_priority = input.GetValue<int64_t>();
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	return Value::BIGINT(ClientConfig::GetConfig(context).query_priority);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Weight
+//===--------------------------------------------------------------------===//
+void QueryWeightSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_weight = ClientConfig().query_weight;
+}
+
+void QueryWeightSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto weight = input.GetValue<uint64_t>();
+	if (weight == 0) {
+		throw InvalidInputException("query_weight must be at least 1");
+	}
+	ClientConfig::GetConfig(context).query_weight = weight;
+}
+
+Value QueryWeightSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_weight);
+}
+
+//===--------------------------------------------------------------------===//
+// Max Memory Intensive Queries
+//===--------------------------------------------------------------------===//
+void MaxMemoryIntensiveQueriesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.max_memory_intensive_queries = input.GetValue<uint64_t>();
+}
+
+void MaxMemoryIntensiveQueriesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.max_memory_intensive_queries = DBConfig().options.max_memory_intensive_queries;
+}
+
+Value MaxMemoryIntensiveQueriesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.max_memory_intensive_queries);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Percentage
+//===--------------------------------------------------------------------===//
+void IndexScanPercentageSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto percentage = input.GetValue<double>();
+	if (percentage < 0 || percentage > 1) {
+		throw InvalidInputException("index_scan_percentage must be between 0 and 1");
+	}
+	config.options.index_scan_percentage = percentage;
+}
+
+void IndexScanPercentageSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_percentage = DBConfig().options.index_scan_percentage;
+}
+
+Value IndexScanPercentageSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.index_scan_percentage);
+}
+
+//===--------------------------------------------------------------------===//
+// Index Scan Max Count
+//===--------------------------------------------------------------------===//
+void IndexScanMaxCountSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.index_scan_max_count = input.GetValue<uint64_t>();
+}
+
+void IndexScanMaxCountSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.index_scan_max_count = DBConfig().options.index_scan_max_count;
+}
+
+Value IndexScanMaxCountSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.index_scan_max_count);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
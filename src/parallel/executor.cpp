@@ -17,6 +17,7 @@
 #include "duckdb/parallel/pipeline_initialize_event.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include <algorithm>
 
@@ -348,16 +349,44 @@ void Executor::Initialize(PhysicalOperator &plan) {
 	InitializeInternal(plan);
 }
 
+//! Whether the plan has a hash join or hash aggregate that is expected to materialize at least "threshold" bytes
+static bool IsMemoryIntensive(PhysicalOperator &op, idx_t threshold) {
+	if (op.type == PhysicalOperatorType::HASH_JOIN || op.type == PhysicalOperatorType::HASH_GROUP_BY) {
+		auto &input = op.type == PhysicalOperatorType::HASH_JOIN ? *op.children[1] : *op.children[0];
+		idx_t row_width = 0;
+		for (auto &type : input.types) {
+			row_width += GetTypeIdSize(type.InternalType());
+		}
+		if (input.estimated_cardinality * row_width >= threshold) {
+			return true;
+		}
+	}
+	for (auto &child : op.children) {
+		if (IsMemoryIntensive(*child, threshold)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (DBConfig::GetConfig(context).options.max_memory_intensive_queries > 0) {
+		// wait for admission before building any state
+		auto &temporary_memory_manager = TemporaryMemoryManager::Get(context);
+		if (IsMemoryIntensive(plan, temporary_memory_manager.GetMinimumReservation(context))) {
+			admission = temporary_memory_manager.Admit(context);
+		}
+	}
 	{
 		lock_guard<mutex> elock(executor_lock);
 		physical_plan = &plan;
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto &config = ClientConfig::GetConfig(context);
+		this->producer = scheduler.CreateProducer(config.query_priority, config.query_weight);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -565,6 +594,7 @@ void Executor::Reset() {
 	events.clear();
 	to_be_rescheduled_tasks.clear();
 	execution_result = PendingExecutionResult::RESULT_NOT_READY;
+	admission.reset();
 }
 
 shared_ptr<Pipeline> Executor::CreateChildPipeline(Pipeline &current, PhysicalOperator &op) {
@@ -1,7 +1,9 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -31,36 +33,171 @@ struct SchedulerThread {
 };
 
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+//! The fair share accounting of a producer. Threads read it without taking a lock, and every queued task holds a
+//! reference to it, so the task is accounted for when it is dequeued
+struct ProducerShare {
+	ProducerShare(int64_t priority, idx_t weight)
+	    : priority(priority), weight(MaxValue<idx_t>(weight, 1)), pending(0), pass(0) {
+	}
+
+	//! Tasks of producers with a higher priority are always executed first
+	const int64_t priority;
+	//! The share of the threads this producer receives relative to other producers with the same priority
+	const idx_t weight;
+	//! The number of scheduled tasks that were not dequeued yet (in the shared queue or in a local queue)
+	atomic<idx_t> pending;
+	//! The virtual time of the producer, which advances by FAIR_SHARE_STRIDE / weight for every dequeued task
+	atomic<idx_t> pass;
+};
+
+struct QueuedTask {
+	shared_ptr<ProducerShare> share;
+	shared_ptr<Task> task;
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<QueuedTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The virtual time a producer advances for every task, divided by its weight
+static constexpr idx_t FAIR_SHARE_STRIDE = idx_t(1) << 20;
+
 struct ConcurrentQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
-
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! The pass of the producer that was served most recently
+	atomic<idx_t> virtual_time {0};
+
+	void Enqueue(QueueProducerToken &token, shared_ptr<Task> task);
+	//! Moves a task that was already accounted for (e.g. from a local queue) to the shared queue
+	void Requeue(QueueProducerToken &token, shared_ptr<Task> task);
+	bool DequeueFromProducer(QueueProducerToken &token, shared_ptr<Task> &task);
+	bool Dequeue(shared_ptr<Task> &task);
+
+	//! Accounts for a newly scheduled task of the producer
+	void Activate(ProducerShare &share);
+	//! Accounts for a dequeued task of the producer
+	void Charge(ProducerShare &share);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, int64_t priority, idx_t weight)
+	    : queue_token(queue.q), share(make_shared<ProducerShare>(priority, weight)) {
 	}
 
 	duckdb_moodycamel::ProducerToken queue_token;
+	mutex producer_lock;
+	shared_ptr<ProducerShare> share;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+struct ScheduledTask {
+	//! The producer that scheduled the task
+	shared_ptr<QueueProducerToken> token;
+	shared_ptr<Task> task;
+};
+
+//! The local task queue of a background thread. The owning thread takes tasks from the back, so tasks that it
+//! scheduled itself (e.g. the next pipeline of a query) tend to run on the thread that produced their input.
+//! Other threads steal from the front.
+struct WorkerQueue {
+	WorkerQueue(TaskScheduler &scheduler, ConcurrentQueue &queue, idx_t index)
+	    : scheduler(scheduler), queue(queue), index(index), producers_version(DConstants::INVALID_INDEX) {
+	}
+
+	TaskScheduler &scheduler;
+	ConcurrentQueue &queue;
+	idx_t index;
+	mutex lock;
+	deque<ScheduledTask> tasks;
+	//! The copy of the producer list used by the owning thread, and the version it was copied at
+	idx_t producers_version;
+	shared_ptr<const producer_list_t> producers;
+
+	void Push(QueueProducerToken &token, shared_ptr<QueueProducerToken> token_ref, shared_ptr<Task> task) {
+		queue.Activate(*token.share);
+		lock_guard<mutex> guard(lock);
+		tasks.push_back(ScheduledTask {std::move(token_ref), std::move(task)});
+	}
+
+	bool Pop(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		queue.Charge(*tasks.back().token->share);
+		task = std::move(tasks.back().task);
+		tasks.pop_back();
+		return true;
+	}
+
+	//! Pops the most recently scheduled task of the given producer
+	bool PopFromProducer(QueueProducerToken &token, shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.rbegin(); it != tasks.rend(); it++) {
+			if (it->token.get() == &token) {
+				queue.Charge(*token.share);
+				task = std::move(it->task);
+				tasks.erase(std::next(it).base());
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+//! The local queue of the background thread running on this thread (if any)
+static thread_local WorkerQueue *current_worker = nullptr;
+
+void ConcurrentQueue::Activate(ProducerShare &share) {
+	if (share.pending++ > 0) {
+		return;
+	}
+	// a producer that was idle does not build up credit: it continues at the current virtual time
+	auto now = virtual_time.load();
+	auto pass = share.pass.load();
+	while (pass < now && !share.pass.compare_exchange_weak(pass, now)) {
+	}
+}
+
+void ConcurrentQueue::Charge(ProducerShare &share) {
+	share.pending--;
+	virtual_time = share.pass.fetch_add(FAIR_SHARE_STRIDE / share.weight);
+}
+
+void ConcurrentQueue::Enqueue(QueueProducerToken &token, shared_ptr<Task> task) {
+	Activate(*token.share);
+	Requeue(token, std::move(task));
+}
+
+void ConcurrentQueue::Requeue(QueueProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	if (q.enqueue(token.queue_token, QueuedTask {token.share, std::move(task)})) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+bool ConcurrentQueue::DequeueFromProducer(QueueProducerToken &token, shared_ptr<Task> &task) {
+	QueuedTask entry;
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (!q.try_dequeue_from_producer(token.queue_token, entry)) {
+			return false;
+		}
+	}
+	Charge(*entry.share);
+	task = std::move(entry.task);
+	return true;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
+	QueuedTask entry;
+	if (!q.try_dequeue(entry)) {
+		return false;
+	}
+	Charge(*entry.share);
+	task = std::move(entry.task);
+	return true;
 }
 
 #else
@@ -68,16 +205,16 @@ struct ConcurrentQueue {
 	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	void Enqueue(QueueProducerToken &token, shared_ptr<Task> task);
+	bool DequeueFromProducer(QueueProducerToken &token, shared_ptr<Task> &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(QueueProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(QueueProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
@@ -88,20 +225,25 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, int64_t priority, idx_t weight) {
 	}
 };
+
+struct WorkerQueue {};
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
+ProducerToken::ProducerToken(TaskScheduler &scheduler, shared_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.UnregisterProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>()), work_stealing(db.config.options.enable_work_stealing),
+      numa_aware(db.config.options.enable_numa_awareness), threads_bound(false),
+      producers(make_shared<const producer_list_t>()), producers_version(0), weighted_producers(0),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
       current_thread_count(1) {
 }
@@ -120,20 +262,239 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(int64_t priority, idx_t weight) {
+	auto token = make_shared<QueueProducerToken>(*queue, priority, weight);
+	auto result = make_uniq<ProducerToken>(*this, token);
+#ifndef DUCKDB_NO_THREADS
+	auto &share = *token->share;
+	lock_guard<mutex> guard(fair_share_lock);
+	// the list is shared with the worker threads, so we replace it instead of modifying it
+	auto new_producers = make_shared<producer_list_t>(*producers);
+	// insert after all producers with the same or a higher priority
+	auto entry = new_producers->begin();
+	while (entry != new_producers->end() && (*entry)->share->priority >= priority) {
+		entry++;
+	}
+	new_producers->insert(entry, std::move(token));
+	producers = std::move(new_producers);
+	producers_version++;
+	if (share.priority != 0 || share.weight != 1) {
+		weighted_producers++;
+	}
+#endif
+	return result;
+}
+
+void TaskScheduler::UnregisterProducer(ProducerToken &token) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(fair_share_lock);
+	auto new_producers = make_shared<producer_list_t>(*producers);
+	for (idx_t i = 0; i < new_producers->size(); i++) {
+		if ((*new_producers)[i] == token.token) {
+			new_producers->erase(new_producers->begin() + static_cast<int64_t>(i));
+			break;
+		}
+	}
+	producers = std::move(new_producers);
+	producers_version++;
+	auto &share = *token.token->share;
+	if (share.priority != 0 || share.weight != 1) {
+		weighted_producers--;
+	}
+#endif
+}
+
+#ifndef DUCKDB_NO_THREADS
+shared_ptr<const producer_list_t> TaskScheduler::GetProducers(optional_ptr<WorkerQueue> worker) {
+	if (!worker) {
+		// other threads do not keep a copy of the list, as it keeps the producers alive
+		lock_guard<mutex> guard(fair_share_lock);
+		return producers;
+	}
+	// the list only changes when queries start or finish, so worker threads only take the lock to refresh their copy
+	if (worker->producers_version != producers_version) {
+		lock_guard<mutex> guard(fair_share_lock);
+		worker->producers = producers;
+		worker->producers_version = producers_version;
+	}
+	return worker->producers;
+}
+
+bool TaskScheduler::DequeueTask(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker) {
+	if (weighted_producers > 0 && DequeueFairShare(task, worker)) {
+		return true;
+	}
+	return queue->Dequeue(task);
+}
+
+bool TaskScheduler::DequeueFairShare(shared_ptr<Task> &task, optional_ptr<WorkerQueue> worker) {
+	auto producers_copy = GetProducers(worker);
+	// producers are sorted by descending priority: among the producers with the highest priority that have tasks
+	// pending, serve the one that is furthest behind its share (i.e. with the lowest pass)
+	optional_ptr<QueueProducerToken> next;
+	for (auto &producer : *producers_copy) {
+		auto &share = *producer->share;
+		if (next && share.priority < next->share->priority) {
+			break;
+		}
+		if (share.pending == 0) {
+			continue;
+		}
+		if (!next || share.pass < next->share->pass) {
+			next = producer.get();
+		}
+	}
+	if (!next) {
+		return false;
+	}
+	// the pending tasks are in the local queue of this thread, the shared queue, or the local queue of another thread
+	if (worker && worker->PopFromProducer(*next, task)) {
+		return true;
+	}
+	return queue->DequeueFromProducer(*next, task) || StealTaskFromProducer(*next, task);
 }
+#endif
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+#ifndef DUCKDB_NO_THREADS
+	auto worker = current_worker;
+	if (work_stealing && worker && &worker->scheduler == this) {
+		// scheduled from a background thread: keep the task local to this thread
+		worker->Push(*token.token, token.token, std::move(task));
+		// wake up a sleeping thread so it can steal the task if this thread stays busy
+		queue->semaphore.signal();
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(*token.token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(*token.token, task)) {
+		return true;
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (work_stealing) {
+		return StealTaskFromProducer(*token.token, task);
+	}
+#endif
+	return false;
+}
+
+#ifndef DUCKDB_NO_THREADS
+bool TaskScheduler::StealTaskFromProducer(QueueProducerToken &token, shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(worker_lock);
+	for (auto &worker : worker_queues) {
+		lock_guard<mutex> worker_guard(worker->lock);
+		for (auto it = worker->tasks.begin(); it != worker->tasks.end(); it++) {
+			if (it->token.get() == &token) {
+				queue->Charge(*token.share);
+				task = std::move(it->task);
+				worker->tasks.erase(it);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::StealTask(shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(worker_lock);
+	for (auto &worker : worker_queues) {
+		lock_guard<mutex> worker_guard(worker->lock);
+		if (!worker->tasks.empty()) {
+			queue->Charge(*worker->tasks.front().token->share);
+			task = std::move(worker->tasks.front().task);
+			worker->tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool TaskScheduler::StealTasks(WorkerQueue &worker, shared_ptr<Task> &task) {
+	vector<ScheduledTask> stolen;
+	{
+		lock_guard<mutex> guard(worker_lock);
+		// start looking at the next worker, so not every thread hits the same victim first
+		for (idx_t i = 1; i < worker_queues.size() && stolen.empty(); i++) {
+			auto &victim = *worker_queues[(worker.index + i) % worker_queues.size()];
+			lock_guard<mutex> victim_guard(victim.lock);
+			// take half of the tasks (rounded up) from the front, the victim keeps working on the back
+			idx_t steal_count = (victim.tasks.size() + 1) / 2;
+			for (idx_t s = 0; s < steal_count; s++) {
+				stolen.push_back(std::move(victim.tasks.front()));
+				victim.tasks.pop_front();
+			}
+		}
+	}
+	if (stolen.empty()) {
+		return false;
+	}
+	// the other stolen tasks are still pending, they just moved to the local queue of this thread
+	queue->Charge(*stolen[0].token->share);
+	task = std::move(stolen[0].task);
+	lock_guard<mutex> guard(worker.lock);
+	for (idx_t i = 1; i < stolen.size(); i++) {
+		worker.tasks.push_back(std::move(stolen[i]));
+	}
+	return true;
+}
+
+bool TaskScheduler::GetTaskForWorker(WorkerQueue &worker, shared_ptr<Task> &task) {
+	// tasks in the local queue are taken without waiting, but we consume the signal that scheduling them sent (if no
+	// other thread was woken up by it yet), so it does not wake up another thread for nothing
+	// with fair share scheduling, the local queue is only used if it holds a task of the producer that is next
+	if (weighted_producers > 0 ? DequeueFairShare(task, &worker) : worker.Pop(task)) {
+		queue->semaphore.tryWait();
+		return true;
+	}
+	queue->semaphore.wait();
+	if (DequeueTask(task, &worker) || worker.Pop(task)) {
+		return true;
+	}
+	// without work stealing, the local queues only hold tasks that were scheduled before it was disabled
+	return work_stealing && StealTasks(worker, task);
 }
 
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, WorkerQueue &worker) {
+	current_worker = &worker;
+	shared_ptr<Task> task;
+	// loop until the marker is set to false
+	while (*marker) {
+		if (!GetTaskForWorker(worker, task)) {
+			continue;
+		}
+		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		switch (execute_result) {
+		case TaskExecutionResult::TASK_FINISHED:
+		case TaskExecutionResult::TASK_ERROR:
+			task.reset();
+			break;
+		case TaskExecutionResult::TASK_NOT_FINISHED:
+			throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
+		case TaskExecutionResult::TASK_BLOCKED:
+			task->Deschedule();
+			task.reset();
+			break;
+		}
+
+		// Flushes the outstanding allocator's outstanding allocations
+		Allocator::ThreadFlush(allocator_flush_threshold);
+	}
+	current_worker = nullptr;
+	// the thread is stopped: hand any remaining local tasks over to the shared queue
+	lock_guard<mutex> guard(worker.lock);
+	for (auto &entry : worker.tasks) {
+		queue->Requeue(*entry.token, std::move(entry.task));
+	}
+	worker.tasks.clear();
+	worker.producers.reset();
+	worker.producers_version = DConstants::INVALID_INDEX;
+}
+#endif
+
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
@@ -141,7 +502,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	while (*marker) {
 		// wait for a signal with a timeout
 		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
+		if (DequeueTask(task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -172,7 +533,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task) && !(work_stealing && StealTask(task))) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -202,7 +563,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task) && !(work_stealing && StealTask(task))) {
 			return;
 		}
 		try {
@@ -228,12 +589,6 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #endif
 }
 
-#ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
-}
-#endif
-
 int32_t TaskScheduler::NumberOfThreads() {
 	return current_thread_count.load();
 }
@@ -258,6 +613,14 @@ void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 }
 
+void TaskScheduler::SetWorkStealing(bool enable) {
+	work_stealing = enable;
+}
+
+void TaskScheduler::SetNumaAwareness(bool enable) {
+	numa_aware = enable;
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	queue->semaphore.signal(n);
@@ -280,12 +643,14 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	idx_t new_thread_count = n;
-	if (threads.size() == new_thread_count) {
+	auto &topology = NumaTopology::Get();
+	bool bind_threads = numa_aware && topology.NodeCount() > 1;
+	if (threads.size() == new_thread_count && threads_bound == bind_threads) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || threads_bound != bind_threads) {
+		// we are reducing the number of threads or changing their placement: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -301,12 +666,28 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
 		idx_t create_new_threads = new_thread_count - threads.size();
+		{
+			// worker queues are kept around when threads are stopped, so other threads never see them disappear
+			lock_guard<mutex> guard(worker_lock);
+			while (worker_queues.size() < new_thread_count) {
+				worker_queues.push_back(make_uniq<WorkerQueue>(*this, *queue, worker_queues.size()));
+			}
+		}
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
+			auto &worker = *worker_queues[threads.size()];
+			// spread the threads over the NUMA nodes round-robin
+			auto node = bind_threads ? threads.size() % topology.NodeCount() : DConstants::INVALID_INDEX;
+			auto run_worker = [this, &worker, &topology, node](atomic<bool> *thread_marker) {
+				if (node != DConstants::INVALID_INDEX) {
+					topology.BindThread(node);
+				}
+				ExecuteForever(thread_marker, worker);
+			};
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(run_worker, marker.get());
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
@@ -318,6 +699,7 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			markers.push_back(std::move(marker));
 		}
 	}
+	threads_bound = bind_threads;
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 #endif
 }
@@ -0,0 +1,106 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(idx_t bit_count) : TableFilter(TableFilterType::BLOOM_FILTER) {
+	D_ASSERT(IsPowerOfTwo(bit_count) && bit_count >= 64);
+	bits.resize(bit_count / 64, 0);
+}
+
+BloomFilter::BloomFilter(vector<idx_t> bits_p) : TableFilter(TableFilterType::BLOOM_FILTER), bits(std::move(bits_p)) {
+	if (bits.empty() || !IsPowerOfTwo(bits.size())) {
+		throw InternalException("BloomFilter: number of blocks must be a power of two");
+	}
+}
+
+idx_t BloomFilter::GetBitCount(idx_t cardinality) {
+	auto bit_count = NextPowerOfTwo(MaxValue<idx_t>(cardinality, 1) * BITS_PER_VALUE);
+	return MinValue<idx_t>(MaxValue<idx_t>(bit_count, MINIMUM_BIT_COUNT), MAXIMUM_BIT_COUNT);
+}
+
+void BloomFilter::Insert(Vector &keys, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(keys, hashes, count);
+
+	UnifiedVectorFormat kdata;
+	keys.ToUnifiedFormat(count, kdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!kdata.validity.RowIsValid(kdata.sel->get_index(i))) {
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		bits[GetBlock(hash)] |= GetMask(hash);
+	}
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	D_ASSERT(bits.size() == other.bits.size());
+	for (idx_t i = 0; i < bits.size(); i++) {
+		bits[i] |= other.bits[i];
+	}
+}
+
+idx_t BloomFilter::Filter(Vector &keys, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	// hash only the rows that are still selected
+	Vector hashes(LogicalType::HASH, sel.get_index(approved_tuple_count - 1) + 1);
+	VectorOperations::Hash(keys, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(approved_tuple_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			continue;
+		}
+		auto hash = hash_data[hdata.sel->get_index(idx)];
+		auto mask = GetMask(hash);
+		if ((bits[GetBlock(hash)] & mask) == mask) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!stats.CanHaveNoNull()) {
+		// only NULL values: no row can pass
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM FILTER";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.bits == bits;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(bits);
+}
+
+} // namespace duckdb
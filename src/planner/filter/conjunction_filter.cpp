@@ -46,6 +46,14 @@ bool ConjunctionOrFilter::Equals(const TableFilter &other_p) const {
 	return true;
 }
 
+unique_ptr<TableFilter> ConjunctionOrFilter::Copy() const {
+	auto result = make_uniq<ConjunctionOrFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 ConjunctionAndFilter::ConjunctionAndFilter() : ConjunctionFilter(TableFilterType::CONJUNCTION_AND) {
 }
 
@@ -91,4 +99,12 @@ bool ConjunctionAndFilter::Equals(const TableFilter &other_p) const {
 	return true;
 }
 
+unique_ptr<TableFilter> ConjunctionAndFilter::Copy() const {
+	auto result = make_uniq<ConjunctionAndFilter>();
+	for (auto &child_filter : child_filters) {
+		result->child_filters.push_back(child_filter->Copy());
+	}
+	return std::move(result);
+}
+
 } // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -35,10 +36,17 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 }
 
 BufferPool::BufferPool(idx_t maximum_memory)
-    : current_memory(0), maximum_memory(maximum_memory), queue(make_uniq<EvictionQueue>()),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0), total_dead_nodes(0) {
+    : current_memory(0), maximum_memory(maximum_memory), eviction_policy(BufferEvictionPolicy::TWO_QUEUE),
+      numa_aware(false), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0) {
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		queues.push_back(make_uniq<EvictionQueue>());
+		total_dead_nodes[i] = 0;
+	}
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		buffer_hits_per_tag[i] = 0;
+		buffer_misses_per_tag[i] = 0;
+		evictions_per_tag[i] = 0;
 	}
 }
 BufferPool::~BufferPool() {
@@ -51,13 +59,18 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	D_ASSERT(handle->readers == 0);
 	auto ts = ++handle->eviction_timestamp;
+	handle->unpin_count++;
+
+	auto previous_queue_type = handle->eviction_queue;
+	auto queue_type = GetEvictionQueueType(*handle);
+	handle->eviction_queue = queue_type;
 
 	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
+	GetEvictionQueue(queue_type).q.enqueue(evict_node);
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+		IncrementDeadNodes(previous_queue_type);
 	}
 
 	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
@@ -87,17 +100,46 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+void BufferPool::SetNumaAwareness(bool enable) {
+	numa_aware = enable;
+}
+
+EvictionQueueType BufferPool::GetEvictionQueueType(BlockHandle &handle) const {
+	switch (eviction_policy.load()) {
+	case BufferEvictionPolicy::LRU:
+		return EvictionQueueType::RECENT;
+	case BufferEvictionPolicy::TWO_QUEUE:
+		// blocks that have only been used once since they were loaded (e.g., by a sequential scan) are evicted first
+		return handle.unpin_count > 1 ? EvictionQueueType::FREQUENT : EvictionQueueType::RECENT;
+	default:
+		throw InternalException("Unsupported buffer eviction policy");
+	}
+}
+
+EvictionQueue &BufferPool::GetEvictionQueue(EvictionQueueType queue_type) {
+	return *queues[uint8_t(queue_type)];
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
 	BufferEvictionNode node;
 	TempBufferPoolReservation r(tag, *this, extra_memory);
 
 	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		// get a block to unpin from the queues
+		EvictionQueueType queue_type;
+		if (!TryDequeue(node, queue_type)) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
+			if (!TryDequeueWithLock(node, queue_type)) {
 				// still no success, we return
 				r.Resize(0);
 				return {false, std::move(r)};
@@ -107,7 +149,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		// get a reference to the underlying block pointer
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
-			DecrementDeadNodes();
+			DecrementDeadNodes(queue_type);
 			continue;
 		}
 
@@ -115,12 +157,14 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		lock_guard<mutex> lock(handle->lock);
 		if (!node.CanUnload(*handle)) {
 			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
+			DecrementDeadNodes(queue_type);
 			continue;
 		}
 
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		evictions_per_tag[uint8_t(handle->tag)]++;
+		if (buffer && handle->buffer->AllocSize() == extra_memory &&
+		    (!numa_aware || handle->buffer->numa_node == NumaTopology::Get().CurrentNode())) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
 			return {true, std::move(r)};
@@ -132,12 +176,24 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 	return {true, std::move(r)};
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
+bool BufferPool::TryDequeue(BufferEvictionNode &node, EvictionQueueType &queue_type) {
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		if (queues[i]->q.try_dequeue(node)) {
+			queue_type = EvictionQueueType(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node, EvictionQueueType &queue_type) {
 	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+	return TryDequeue(node, queue_type);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void BufferPool::PurgeIteration(EvictionQueueType queue_type, const idx_t purge_size) {
+	auto &queue = GetEvictionQueue(queue_type);
+
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -147,7 +203,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = queue.q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -155,27 +211,35 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			queue.q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
 
-	total_dead_nodes -= actually_dequeued - alive_nodes;
+	total_dead_nodes[uint8_t(queue_type)] -= actually_dequeued - alive_nodes;
 }
 
 void BufferPool::PurgeQueue() {
 
-	// only one thread purges the queue, all other threads early-out
+	// only one thread purges the queues, all other threads early-out
 	if (!purge_lock.try_lock()) {
 		return;
 	}
 	lock_guard<mutex> lock {purge_lock, std::adopt_lock};
 
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		PurgeQueue(EvictionQueueType(i));
+	}
+}
+
+void BufferPool::PurgeQueue(EvictionQueueType queue_type) {
+	auto &queue = GetEvictionQueue(queue_type);
+
 	// we purge INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER nodes
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = queue.q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -202,17 +266,17 @@ void BufferPool::PurgeQueue() {
 	idx_t max_purges = approx_q_size / purge_size;
 	while (max_purges != 0) {
 
-		PurgeIteration(purge_size);
+		PurgeIteration(queue_type, purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = queue.q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 			break;
 		}
 
-		idx_t approx_dead_nodes = total_dead_nodes;
+		idx_t approx_dead_nodes = total_dead_nodes[uint8_t(queue_type)];
 		approx_dead_nodes = approx_dead_nodes > approx_q_size ? approx_q_size : approx_dead_nodes;
 		idx_t approx_alive_nodes = approx_q_size - approx_dead_nodes;
 
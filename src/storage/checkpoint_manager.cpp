@@ -29,6 +29,7 @@
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/unknown_index.hpp"
 
 namespace duckdb {
@@ -480,11 +481,12 @@ void CheckpointReader::ReadIndex(ClientContext &context, Deserializer &deseriali
 	D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
 
 	// This is executed before any extensions can be loaded, which is why we must treat any index type that is not
-	// built-in (ART) as unknown
-	if (info.index_type == ART::TYPE_NAME) {
-		data_table.info->indexes.AddIndex(make_uniq<ART>(info.index_name, info.constraint_type, info.column_ids,
-		                                                 TableIOManager::Get(data_table), unbound_expressions,
-		                                                 data_table.db, nullptr, index_storage_info));
+	// built-in (ART, BRIN) as unknown
+	auto index_type = context.db->config.GetIndexTypes().FindByName(info.index_type);
+	if (index_type) {
+		CreateIndexInput input(TableIOManager::Get(data_table), data_table.db, info.constraint_type, info.index_name,
+		                       info.column_ids, unbound_expressions, index_storage_info, info.options);
+		data_table.info->indexes.AddIndex(index_type->create_instance(input));
 	} else {
 		auto unknown_index = make_uniq<UnknownIndex>(info.index_name, info.index_type, info.constraint_type,
 		                                             info.column_ids, TableIOManager::Get(data_table),
@@ -5,6 +5,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -224,6 +225,12 @@ idx_t DataTable::MaxThreads(ClientContext &context) {
 
 void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScanState &state) {
 	row_groups->InitializeParallelScan(state.scan_state);
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.enable_numa_awareness && !config.options.preserve_insertion_order &&
+	    !ClientConfig::GetConfig(context).verify_parallelism) {
+		// row groups are handed out out of order, which is only allowed if no batch indexes are used
+		row_groups->InitializeNumaParallelScan(state.scan_state, NumaTopology::Get().NodeCount());
+	}
 
 	auto &local_storage = LocalStorage::Get(context, db);
 	local_storage.InitializeParallelScan(*this, state.local_state);
@@ -14,7 +14,7 @@ Index::Index(const string &name, const string &index_type, IndexConstraintType i
              const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db)
 
     : name(name), index_type(index_type), index_constraint_type(index_constraint_type), column_ids(column_ids),
-      table_io_manager(table_io_manager), db(db) {
+      table_io_manager(table_io_manager), db(db), shared_lock_count(0) {
 
 	if (!Radix::IsLittleEndian()) {
 		throw NotImplementedException("indexes are not supported on big endian architectures");
@@ -27,16 +27,33 @@ Index::Index(const string &name, const string &index_type, IndexConstraintType i
 		bound_expressions.push_back(BindExpression(unbound_expression->Copy()));
 		this->unbound_expressions.emplace_back(std::move(unbound_expression));
 	}
-	for (auto &bound_expr : bound_expressions) {
-		executor.AddExpression(*bound_expr);
-	}
 
 	// create the column id set
 	column_id_set.insert(column_ids.begin(), column_ids.end());
 }
 
+IndexSharedLock::IndexSharedLock(Index &index) : index(index) {
+	// lookups wait for any change to the index that holds (or waits for) the exclusive lock
+	lock_guard<mutex> guard(index.lock);
+	lock_guard<mutex> count_guard(index.shared_lock_mutex);
+	if (index.shared_lock_count++ == 0) {
+		index.UnpinBuffers();
+	}
+}
+
+IndexSharedLock::~IndexSharedLock() {
+	lock_guard<mutex> count_guard(index.shared_lock_mutex);
+	if (--index.shared_lock_count == 0) {
+		index.shared_lock_cv.notify_all();
+	}
+}
+
 void Index::InitializeLock(IndexLock &state) {
 	state.index_lock = unique_lock<mutex>(lock);
+	// no new lookups can start while we hold the lock, wait for the running ones to finish
+	unique_lock<mutex> count_lock(shared_lock_mutex);
+	shared_lock_cv.wait(count_lock, [&]() { return shared_lock_count == 0; });
+	UnpinBuffers();
 }
 
 ErrorData Index::Append(DataChunk &entries, Vector &row_identifiers) {
@@ -82,6 +99,8 @@ idx_t Index::GetInMemorySize() {
 }
 
 void Index::ExecuteExpressions(DataChunk &input, DataChunk &result) {
+	// lookups execute the expressions concurrently, so every execution uses its own executor
+	ExpressionExecutor executor(bound_expressions);
 	executor.Execute(input, result);
 }
 
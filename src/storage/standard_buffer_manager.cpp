@@ -175,10 +175,12 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			buffer_pool.buffer_hits_per_tag[uint8_t(handle->tag)]++;
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
 	}
+	buffer_pool.buffer_misses_per_tag[uint8_t(handle->tag)]++;
 	// evict blocks until we have space for the current block
 	unique_ptr<FileBuffer> reusable_buffer;
 	auto reservation =
@@ -259,6 +261,9 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.buffer_hits_per_tag[k].load();
+		info.buffer_misses = buffer_pool.buffer_misses_per_tag[k].load();
+		info.evictions = buffer_pool.evictions_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -294,8 +299,9 @@ void StandardBufferManager::RequireTemporaryDirectory() {
 void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
 	if (buffer.size == Storage::BLOCK_SIZE) {
-		evicted_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
-		temp_directory_handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
+		// account for the size of the (possibly compressed) slot that was actually written
+		auto slot_size = temp_directory_handle->GetTempFile().WriteTemporaryBuffer(tag, block_id, buffer);
+		evicted_data_per_tag[uint8_t(tag)] += slot_size;
 		return;
 	}
 	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
@@ -314,8 +320,11 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	D_ASSERT(!temp_directory.empty());
 	D_ASSERT(temp_directory_handle.get());
 	if (temp_directory_handle->GetTempFile().HasTemporaryBuffer(id)) {
-		evicted_data_per_tag[uint8_t(tag)] -= Storage::BLOCK_SIZE;
-		return temp_directory_handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
+		idx_t slot_size;
+		auto &temp_file = temp_directory_handle->GetTempFile();
+		auto buffer = temp_file.ReadTemporaryBuffer(id, std::move(reusable_buffer), slot_size);
+		evicted_data_per_tag[uint8_t(tag)] -= slot_size;
+		return buffer;
 	}
 	idx_t block_size;
 	// open the temporary file and read the size
@@ -183,6 +183,10 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			return false;
 		}
 	}
+	if (state.NextRowInRanges(start + vector_offset * STANDARD_VECTOR_SIZE, start + count) == start + count) {
+		// the row group contains no rows of the row id ranges
+		return false;
+	}
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
@@ -215,6 +219,10 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			return false;
 		}
 	}
+	if (state.NextRowInRanges(start, start + count) == start + count) {
+		// the row group contains no rows of the row id ranges
+		return false;
+	}
 	state.row_group = this;
 	state.vector_index = 0;
 	state.max_row_group_row =
@@ -400,6 +408,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -459,6 +468,20 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 		idx_t current_row = state.vector_index * STANDARD_VECTOR_SIZE;
 		auto max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.max_row_group_row - current_row);
 
+		//! skip the vectors that contain no rows of the row id ranges
+		if (state.row_ranges) {
+			auto next_row = state.NextRowInRanges(this->start + current_row, this->start + state.max_row_group_row);
+			auto target_vector_index = (next_row - this->start) / STANDARD_VECTOR_SIZE;
+			if (next_row == this->start + state.max_row_group_row) {
+				target_vector_index = (state.max_row_group_row + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+			}
+			if (state.vector_index < target_vector_index) {
+				while (state.vector_index < target_vector_index) {
+					NextVector(state);
+				}
+				continue;
+			}
+		}
 		//! first check the zonemap if we have to scan this partition
 		if (!CheckZonemapSegments(state)) {
 			continue;
@@ -11,6 +11,7 @@
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/numa.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -168,6 +169,33 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.node_ranges.clear();
+}
+
+void RowGroupCollection::InitializeNumaParallelScan(ParallelCollectionScanState &state, idx_t node_count) {
+	auto last_row_group = row_groups->GetSegmentByIndex(-1);
+	if (node_count <= 1 || !last_row_group) {
+		return;
+	}
+	auto row_group_count = last_row_group->index + 1;
+	for (idx_t node = 0; node < node_count; node++) {
+		state.node_ranges.push_back({node * row_group_count / node_count, (node + 1) * row_group_count / node_count});
+	}
+}
+
+//! Take the next row group of the node the calling thread runs on, or of another node if that range is done
+static RowGroup *NextNodeRowGroup(RowGroupSegmentTree &row_groups, ParallelCollectionScanState &state) {
+	auto node = NumaTopology::Get().CurrentNode();
+	for (idx_t i = 0; i < state.node_ranges.size(); i++) {
+		auto &range = state.node_ranges[(node + i) % state.node_ranges.size()];
+		while (range.next < range.end) {
+			auto row_group = row_groups.GetSegmentByIndex(NumericCast<int64_t>(range.next++));
+			if (row_group && row_group->count > 0 && row_group->start < state.max_row) {
+				return row_group;
+			}
+		}
+	}
+	return nullptr;
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -180,13 +208,22 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
-			if (!state.current_row_group || state.current_row_group->count == 0) {
+			if (!state.node_ranges.empty()) {
+				row_group = NextNodeRowGroup(*row_groups, state);
+				if (!row_group) {
+					// no more data left to scan
+					break;
+				}
+				collection = state.collection;
+				state.processed_rows += row_group->count;
+				vector_index = 0;
+				max_row = row_group->start + row_group->count;
+			} else if (!state.current_row_group || state.current_row_group->count == 0) {
 				// no more data left to scan
 				break;
-			}
-			collection = state.collection;
-			row_group = state.current_row_group;
-			if (ClientConfig::GetConfig(context).verify_parallelism) {
+			} else if (ClientConfig::GetConfig(context).verify_parallelism) {
+				collection = state.collection;
+				row_group = state.current_row_group;
 				vector_index = state.vector_index;
 				max_row = state.current_row_group->start +
 				          MinValue<idx_t>(state.current_row_group->count,
@@ -198,6 +235,8 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 					state.vector_index = 0;
 				}
 			} else {
+				collection = state.collection;
+				row_group = state.current_row_group;
 				state.processed_rows += state.current_row_group->count;
 				vector_index = 0;
 				max_row = state.current_row_group->start + state.current_row_group->count;
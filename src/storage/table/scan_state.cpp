@@ -76,6 +76,19 @@ TableScanOptions &CollectionScanState::GetOptions() {
 	return parent.options;
 }
 
+idx_t CollectionScanState::NextRowInRanges(idx_t row, idx_t end) const {
+	if (!row_ranges) {
+		return MinValue<idx_t>(row, end);
+	}
+	// the first range that ends after the row
+	auto entry = std::lower_bound(row_ranges->begin(), row_ranges->end(), row,
+	                              [](const RowIdRange &range, idx_t row) { return range.end <= row; });
+	if (entry == row_ranges->end()) {
+		return end;
+	}
+	return MinValue<idx_t>(MaxValue<idx_t>(row, entry->start), end);
+}
+
 ParallelCollectionScanState::ParallelCollectionScanState()
     : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
 }
@@ -1,9 +1,22 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "lz4.hpp"
 
 namespace duckdb {
 
+//! Returns the scratch buffer of this thread that (de)compressed temporary buffers are staged in
+//! This is deliberately not allocated through the buffer manager: buffers are written to temporary files while
+//! the buffer manager is evicting, and reserving memory there could recursively trigger another eviction
+static data_ptr_t GetCompressionScratchBuffer() {
+	static thread_local unsafe_unique_array<data_t> scratch_buffer;
+	if (!scratch_buffer) {
+		auto compressed_bound = duckdb_lz4::LZ4_compressBound(NumericCast<int>(Storage::BLOCK_SIZE));
+		scratch_buffer = make_unsafe_uniq_array<data_t>(sizeof(idx_t) + NumericCast<idx_t>(compressed_bound));
+	}
+	return scratch_buffer.get();
+}
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
@@ -68,10 +81,17 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, TemporaryBufferSize size) {
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	return "duckdb_temp_storage_" + to_string(idx_t(size) / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
+                                         idx_t index, TemporaryBufferSize size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index), size(size),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, size))) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -90,16 +110,31 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             data_ptr_t compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (size == TemporaryBufferSize::DEFAULT) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	D_ASSERT(compressed_buffer);
+	handle->Write(compressed_buffer, idx_t(size), GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (size == TemporaryBufferSize::DEFAULT) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, GetPositionInFile(block_index), Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	}
+	// read the compressed buffer and decompress it into a block-sized buffer
+	// the block-sized buffer is constructed first: this can evict (and compress) other buffers on this thread
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto compressed_buffer = GetCompressionScratchBuffer();
+	handle->Read(compressed_buffer, idx_t(size), GetPositionInFile(block_index));
+	TemporaryFileManager::DecompressBuffer(compressed_buffer, *buffer);
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -153,7 +188,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * idx_t(size);
 }
 
 //===--------------------------------------------------------------------===//
@@ -226,21 +261,84 @@ bool TemporaryFileIndex::IsValid() const {
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
     : db(db), temp_directory(temp_directory_p) {
+	for (auto &skip_count : compression_skip_count) {
+		skip_count = 0;
+	}
 }
 
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
-void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
+static TemporaryBufferSize RoundUpToBufferSize(idx_t size) {
+	static constexpr const TemporaryBufferSize BUFFER_SIZES[] = {
+	    TemporaryBufferSize::S32K,  TemporaryBufferSize::S64K,  TemporaryBufferSize::S96K,
+	    TemporaryBufferSize::S128K, TemporaryBufferSize::S160K, TemporaryBufferSize::S192K,
+	    TemporaryBufferSize::S224K};
+	for (auto &buffer_size : BUFFER_SIZES) {
+		if (size <= idx_t(buffer_size)) {
+			return buffer_size;
+		}
+	}
+	return TemporaryBufferSize::DEFAULT;
+}
+
+TemporaryBufferSize TemporaryFileManager::CompressBuffer(MemoryTag tag, FileBuffer &buffer,
+                                                         data_ptr_t compressed_buffer) {
+	auto &skip_count = compression_skip_count[uint8_t(tag)];
+	if (skip_count > 0) {
+		// a recent buffer with this tag did not compress well: only retry compression periodically
+		// note that this is racy, but we only use the count as a heuristic
+		skip_count--;
+		return TemporaryBufferSize::DEFAULT;
+	}
+	// the compressed buffer is prefixed with the compressed size
+	auto compressed_bound = duckdb_lz4::LZ4_compressBound(NumericCast<int>(Storage::BLOCK_SIZE));
+	auto compressed_data = compressed_buffer + sizeof(idx_t);
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.buffer),
+	                                                        char_ptr_cast(compressed_data),
+	                                                        NumericCast<int>(Storage::BLOCK_SIZE), compressed_bound);
+	auto result = compressed_size <= 0 ? TemporaryBufferSize::DEFAULT
+	                                   : RoundUpToBufferSize(sizeof(idx_t) + NumericCast<idx_t>(compressed_size));
+	if (result == TemporaryBufferSize::DEFAULT) {
+		// compression did not save enough to fit into a smaller slot: write the buffer uncompressed
+		skip_count = COMPRESSION_RETRY_INTERVAL;
+		return result;
+	}
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer);
+	// zero-initialize the remainder of the slot, so we never write uninitialized memory to disk
+	auto written_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+	memset(compressed_buffer + written_size, 0, idx_t(result) - written_size);
+	return result;
+}
+
+void TemporaryFileManager::DecompressBuffer(const_data_ptr_t compressed_buffer, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	auto compressed_size = Load<idx_t>(compressed_buffer);
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer + sizeof(idx_t)), char_ptr_cast(buffer.buffer),
+	    NumericCast<int>(compressed_size), NumericCast<int>(Storage::BLOCK_SIZE));
+	if (decompressed_size != NumericCast<int>(Storage::BLOCK_SIZE)) {
+		throw IOException("Failed to decompress buffer read from temporary file: the temporary file may be corrupt");
+	}
+}
+
+idx_t TemporaryFileManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
+	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// first try to compress the buffer, this determines which file we write it to
+	auto compressed_buffer = GetCompressionScratchBuffer();
+	auto buffer_size = CompressBuffer(tag, buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the right slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetBufferSize() != buffer_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -250,7 +348,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, buffer_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -261,7 +360,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
+	return idx_t(buffer_size);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -269,8 +369,8 @@ bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
 	return used_blocks.find(block_id) != used_blocks.end();
 }
 
-unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
-                                                                 unique_ptr<FileBuffer> reusable_buffer) {
+unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer,
+                                                                 idx_t &slot_size) {
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle;
 	{
@@ -278,6 +378,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
+	slot_size = idx_t(handle->GetBufferSize());
 	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
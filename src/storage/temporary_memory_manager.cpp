@@ -1,6 +1,8 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -34,7 +36,16 @@ idx_t TemporaryMemoryState::GetReservation() const {
 	return reservation;
 }
 
-TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0) {
+TemporaryMemoryAdmission::TemporaryMemoryAdmission(TemporaryMemoryManager &temporary_memory_manager_p,
+                                                   ClientContext &context_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p) {
+}
+
+TemporaryMemoryAdmission::~TemporaryMemoryAdmission() {
+	temporary_memory_manager.Release(*this);
+}
+
+TemporaryMemoryManager::TemporaryMemoryManager() : reservation(0), remaining_size(0), max_admitted_queries(0) {
 }
 
 unique_lock<mutex> TemporaryMemoryManager::Lock() {
@@ -49,6 +60,7 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	has_temporary_directory = buffer_manager.HasTemporaryDirectory();
 	num_threads = task_scheduler.NumberOfThreads();
 	query_max_memory = buffer_manager.GetQueryMaxMemory();
+	max_admitted_queries = DBConfig::GetConfig(context).options.max_memory_intensive_queries;
 }
 
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
@@ -59,8 +71,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
-	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
-	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto minimum_reservation = GetMinimumReservationInternal();
 	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
@@ -70,6 +81,59 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	return result;
 }
 
+idx_t TemporaryMemoryManager::GetMinimumReservationInternal() const {
+	return MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
+	                memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+}
+
+idx_t TemporaryMemoryManager::GetMinimumReservation(ClientContext &context) {
+	auto guard = Lock();
+	UpdateConfiguration(context);
+	return GetMinimumReservationInternal();
+}
+
+bool TemporaryMemoryManager::CanAdmit(ClientContext &context) const {
+	if (max_admitted_queries == 0 || admitted_queries.empty()) {
+		// no limit, or nothing else is running: always admit so we make progress
+		return true;
+	}
+	if (admitted_queries.find(context) != admitted_queries.end()) {
+		// nested query of a client that was already admitted
+		return true;
+	}
+	if (admitted_queries.size() >= max_admitted_queries) {
+		return false;
+	}
+	// only admit if the current reservations leave room for the new query
+	return reservation + GetMinimumReservationInternal() <= memory_limit;
+}
+
+unique_ptr<TemporaryMemoryAdmission> TemporaryMemoryManager::Admit(ClientContext &context) {
+	auto guard = Lock();
+	UpdateConfiguration(context);
+	while (!CanAdmit(context)) {
+		if (context.interrupted) {
+			throw InterruptException();
+		}
+		admission_cv.wait_for(guard, std::chrono::milliseconds(ADMISSION_TIMEOUT_MS));
+		UpdateConfiguration(context);
+	}
+	admitted_queries[context]++;
+	return unique_ptr<TemporaryMemoryAdmission>(new TemporaryMemoryAdmission(*this, context));
+}
+
+void TemporaryMemoryManager::Release(TemporaryMemoryAdmission &admission) {
+	{
+		auto guard = Lock();
+		auto entry = admitted_queries.find(admission.context);
+		D_ASSERT(entry != admitted_queries.end());
+		if (--entry->second == 0) {
+			admitted_queries.erase(entry);
+		}
+	}
+	admission_cv.notify_all();
+}
+
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
 
@@ -130,6 +194,8 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	active_states.erase(temporary_memory_state);
 
 	Verify();
+	// queries waiting for admission may fit now
+	admission_cv.notify_all();
 }
 
 void TemporaryMemoryManager::Verify() const {
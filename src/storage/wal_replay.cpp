@@ -25,10 +25,39 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/queue.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/reference_map.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+//! A raw (size-prefixed and checksummed) WAL entry
+struct WALEntryData {
+	unique_ptr<data_t[]> data;
+	idx_t size = 0;
+};
+
+//! The insert entries into a single table that are buffered, so they can be appended in parallel with inserts into
+//! other tables
+struct BufferedTableInserts {
+	explicit BufferedTableInserts(TableCatalogEntry &table_p) : table(table_p) {
+	}
+
+	TableCatalogEntry &table;
+	//! The (checksum-verified) insert entries in WAL order - these are only deserialized when they are appended
+	vector<WALEntryData> entries;
+};
+
 class ReplayState {
+	//! The maximum amount of buffered insert data before the buffered inserts are appended
+	static constexpr const idx_t MAXIMUM_BUFFERED_INSERT_SIZE = 64ULL * 1024ULL * 1024ULL;
+
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
 	}
@@ -37,10 +66,279 @@ public:
 	ClientContext &context;
 	Catalog &catalog;
 	optional_ptr<TableCatalogEntry> current_table;
+	//! The append into current_table that is in progress - consecutive inserts into the same table share one append
+	unique_ptr<LocalAppendState> current_append;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+	//! The buffered inserts per table
+	reference_map_t<TableCatalogEntry, unique_ptr<BufferedTableInserts>> buffered_inserts;
+	//! The total size of the buffered insert entries
+	idx_t buffered_size = 0;
+
+public:
+	void Append(DataChunk &chunk) {
+		// appends into a table that is not buffered can verify constraints against other tables (e.g. foreign keys)
+		// append all buffered inserts first, so these see the inserts that came before them in the WAL
+		AppendBufferedInserts();
+		auto &storage = current_table->GetStorage();
+		if (!current_append) {
+			current_append = make_uniq<LocalAppendState>();
+			storage.InitializeLocalAppend(*current_append, context);
+		}
+		storage.LocalAppend(*current_append, *current_table, context, chunk);
+	}
+	//! Finalize any in-progress append - this must happen before any entry that is not an insert into the same table
+	void FlushAppend() {
+		if (!current_append) {
+			return;
+		}
+		auto append = std::move(current_append);
+		current_table->GetStorage().FinalizeLocalAppend(*append);
+	}
+	//! Finalize the in-progress append and append all buffered inserts - this must happen before any entry that
+	//! is not an insert (or a switch to another table)
+	void FlushAllAppends() {
+		FlushAppend();
+		AppendBufferedInserts();
+	}
+	//! Abandon any in-progress append and buffered inserts (e.g. prior to rolling back the transaction)
+	void AbortAppend() {
+		current_append.reset();
+		buffered_inserts.clear();
+		buffered_size = 0;
+	}
+
+	//! Whether or not inserts into the current table can be buffered and appended in parallel with other tables
+	//! This is only the case if verifying an append only looks at the table itself
+	bool CanBufferInserts() {
+		if (current_table->HasGeneratedColumns()) {
+			return false;
+		}
+		for (auto &constraint : current_table->GetConstraints()) {
+			if (constraint->type == ConstraintType::CHECK || constraint->type == ConstraintType::FOREIGN_KEY) {
+				return false;
+			}
+		}
+		return true;
+	}
+	//! Buffer an insert entry into the current table
+	void BufferInsert(WALEntryData entry) {
+		auto &table_inserts = buffered_inserts[*current_table];
+		if (!table_inserts) {
+			table_inserts = make_uniq<BufferedTableInserts>(*current_table);
+		}
+		buffered_size += entry.size;
+		table_inserts->entries.push_back(std::move(entry));
+		if (buffered_size >= MAXIMUM_BUFFERED_INSERT_SIZE) {
+			AppendBufferedInserts();
+		}
+	}
+	//! Append the buffered inserts - every table is appended to by a single thread, different tables in parallel
+	void AppendBufferedInserts();
+
+private:
+	void AppendInserts(BufferedTableInserts &inserts);
 };
 
+//! Reads the next checksummed entry from the WAL into memory and verifies its checksum
+static WALEntryData ReadWALEntry(BufferedFileReader &stream) {
+	// read the checksum and size
+	auto size = stream.Read<uint64_t>();
+	auto stored_checksum = stream.Read<uint64_t>();
+	auto offset = stream.CurrentOffset();
+	auto file_size = stream.FileSize();
+
+	if (offset + size > file_size) {
+		throw SerializationException(
+		    "Corrupt WAL file: entry size exceeded remaining data in file at byte position %llu "
+		    "(found entry with size %llu bytes, file size %llu bytes)",
+		    offset, size, file_size);
+	}
+
+	// allocate a buffer and read data into the buffer
+	WALEntryData entry;
+	entry.data = unique_ptr<data_t[]>(new data_t[size]);
+	entry.size = size;
+	stream.ReadData(entry.data.get(), size);
+
+	// compute and verify the checksum
+	auto computed_checksum = Checksum(entry.data.get(), size);
+	if (stored_checksum != computed_checksum) {
+		throw SerializationException("Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
+		                             "stored checksum %llu",
+		                             offset, computed_checksum, stored_checksum);
+	}
+	return entry;
+}
+
+//! The WALEntryPrefetcher reads and verifies checksummed WAL entries on a background thread, so that file I/O and
+//! checksum computation overlap with replaying the entries on the main thread
+class WALEntryPrefetcher {
+public:
+	//! The maximum amount of entry data that is read ahead of the replay
+	static constexpr const idx_t MAXIMUM_PREFETCH_SIZE = 64ULL * 1024ULL * 1024ULL;
+
+public:
+	explicit WALEntryPrefetcher(BufferedFileReader &reader_p) : reader(reader_p) {
+#ifndef DUCKDB_NO_THREADS
+		prefetch_thread = make_uniq<thread>([this]() { PrefetchEntries(); });
+#endif
+	}
+	~WALEntryPrefetcher() {
+#ifndef DUCKDB_NO_THREADS
+		{
+			lock_guard<mutex> guard(lock);
+			cancelled = true;
+		}
+		cv.notify_all();
+		prefetch_thread->join();
+#endif
+	}
+
+	//! Fetch the next entry - returns false if the end of the WAL was reached, or throws if the entry is corrupt
+	bool Next(WALEntryData &result) {
+#ifdef DUCKDB_NO_THREADS
+		if (reader.Finished()) {
+			return false;
+		}
+		result = ReadWALEntry(reader);
+		return true;
+#else
+		unique_lock<mutex> guard(lock);
+		cv.wait(guard, [&]() { return !entries.empty() || finished; });
+		if (entries.empty()) {
+			if (error.HasError()) {
+				error.Throw();
+			}
+			return false;
+		}
+		result = std::move(entries.front());
+		entries.pop();
+		buffered_size -= result.size;
+		guard.unlock();
+		cv.notify_all();
+		return true;
+#endif
+	}
+
+private:
+	void PrefetchEntries() {
+		try {
+			while (!reader.Finished()) {
+				auto entry = ReadWALEntry(reader);
+				unique_lock<mutex> guard(lock);
+				// wait until there is room in the buffer - we always allow at least one entry to be buffered
+				cv.wait(guard, [&]() { return buffered_size < MAXIMUM_PREFETCH_SIZE || cancelled; });
+				if (cancelled) {
+					return;
+				}
+				buffered_size += entry.size;
+				entries.push(std::move(entry));
+				guard.unlock();
+				cv.notify_all();
+			}
+		} catch (std::exception &ex) {
+			lock_guard<mutex> guard(lock);
+			error = ErrorData(ex);
+		} catch (...) { // LCOV_EXCL_START
+			lock_guard<mutex> guard(lock);
+			error = ErrorData("Unknown exception while reading WAL entry");
+		} // LCOV_EXCL_STOP
+		{
+			lock_guard<mutex> guard(lock);
+			finished = true;
+		}
+		cv.notify_all();
+	}
+
+private:
+	BufferedFileReader &reader;
+	mutex lock;
+	std::condition_variable cv;
+	//! The entries that have been read but not yet replayed
+	queue<WALEntryData> entries;
+	//! The total size of the buffered entries
+	idx_t buffered_size = 0;
+	//! Whether or not the prefetcher has read the entire file (or encountered an error)
+	bool finished = false;
+	//! Whether or not the replay has been cancelled
+	bool cancelled = false;
+	//! The error encountered while reading entries (if any)
+	ErrorData error;
+	unique_ptr<thread> prefetch_thread;
+};
+
+//===--------------------------------------------------------------------===//
+// Buffered Inserts
+//===--------------------------------------------------------------------===//
+void ReplayState::AppendBufferedInserts() {
+	if (buffered_inserts.empty()) {
+		return;
+	}
+	vector<reference<BufferedTableInserts>> tables;
+	for (auto &entry : buffered_inserts) {
+		tables.push_back(*entry.second);
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto thread_count = MinValue<idx_t>(tables.size(), NumericCast<idx_t>(scheduler.NumberOfThreads()));
+	atomic<idx_t> next_table(0);
+	vector<ErrorData> errors(thread_count);
+	auto append_tables = [&](idx_t thread_idx) {
+		try {
+			for (idx_t table_idx = next_table++; table_idx < tables.size(); table_idx = next_table++) {
+				AppendInserts(tables[table_idx]);
+			}
+		} catch (std::exception &ex) {
+			errors[thread_idx] = ErrorData(ex);
+		} catch (...) { // LCOV_EXCL_START
+			errors[thread_idx] = ErrorData("Unknown exception while appending WAL inserts");
+		} // LCOV_EXCL_STOP
+	};
+#ifndef DUCKDB_NO_THREADS
+	vector<unique_ptr<thread>> threads;
+	for (idx_t thread_idx = 1; thread_idx < thread_count; thread_idx++) {
+		threads.push_back(make_uniq<thread>(append_tables, thread_idx));
+	}
+#endif
+	append_tables(0);
+#ifndef DUCKDB_NO_THREADS
+	for (auto &append_thread : threads) {
+		append_thread->join();
+	}
+#endif
+	buffered_inserts.clear();
+	buffered_size = 0;
+	for (auto &error : errors) {
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+}
+
+void ReplayState::AppendInserts(BufferedTableInserts &inserts) {
+	auto &storage = inserts.table.GetStorage();
+	LocalAppendState append_state;
+	storage.InitializeLocalAppend(append_state, context);
+	for (auto &entry : inserts.entries) {
+		DataChunk chunk;
+		MemoryStream stream(entry.data.get(), entry.size);
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (wal_type != WALType::INSERT_TUPLE) {
+			throw InternalException("Corrupt WAL: buffered entry is not an insert");
+		}
+		deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+		deserializer.End();
+
+		storage.LocalAppend(append_state, inserts.table, context, chunk);
+		// release the entry as soon as it has been appended
+		entry.data.reset();
+	}
+	storage.FinalizeLocalAppend(append_state);
+}
+
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
@@ -63,41 +361,43 @@ public:
 			throw IOException("Failed to read WAL of version %llu - can only read version 1 and 2",
 			                  state_p.wal_version);
 		}
-		// read the checksum and size
-		auto size = stream.Read<uint64_t>();
-		auto stored_checksum = stream.Read<uint64_t>();
-		auto offset = stream.CurrentOffset();
-		auto file_size = stream.FileSize();
-
-		if (offset + size > file_size) {
-			throw SerializationException(
-			    "Corrupt WAL file: entry size exceeded remaining data in file at byte position %llu "
-			    "(found entry with size %llu bytes, file size %llu bytes)",
-			    offset, size, file_size);
-		}
+		auto entry = ReadWALEntry(stream);
+		return WriteAheadLogDeserializer(state_p, std::move(entry.data), entry.size, deserialize_only);
+	}
 
-		// allocate a buffer and read data into the buffer
-		auto buffer = unique_ptr<data_t[]>(new data_t[size]);
-		stream.ReadData(buffer.get(), size);
-
-		// compute and verify the checksum
-		auto computed_checksum = Checksum(buffer.get(), size);
-		if (stored_checksum != computed_checksum) {
-			throw SerializationException(
-			    "Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
-			    "stored checksum %llu",
-			    offset, computed_checksum, stored_checksum);
-		}
-		return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+	static WriteAheadLogDeserializer Open(ReplayState &state_p, WALEntryData &entry) {
+		return WriteAheadLogDeserializer(state_p, std::move(entry.data), entry.size);
 	}
 
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (!DeserializeOnly()) {
+			if (wal_type == WALType::USE_TABLE) {
+				// the in-progress append is into the previous table - buffered inserts into other tables can stay
+				state.FlushAppend();
+			} else if (wal_type != WALType::INSERT_TUPLE) {
+				// inserts are appended to tables in batches - finish all batches before replaying anything else
+				state.FlushAllAppends();
+			} else if (data && state.current_table && state.CanBufferInserts()) {
+				// the entry is held in memory and its checksum has been verified
+				// buffer it, so that inserts into different tables are deserialized and appended in parallel
+				WALEntryData entry;
+				entry.size = stream.GetCapacity();
+				entry.data = std::move(data);
+				state.BufferInsert(std::move(entry));
+				return false;
+			}
+		}
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
 			return true;
 		}
+		if (DeserializeOnly() && data && IsDataEntry(wal_type)) {
+			// the entry is held in memory and its checksum has been verified
+			// when only scanning for a checkpoint flag there is no need to decode the (potentially large) data chunk
+			return false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -108,6 +408,11 @@ public:
 	}
 
 protected:
+	static bool IsDataEntry(WALType wal_type) {
+		return wal_type == WALType::INSERT_TUPLE || wal_type == WALType::DELETE_TUPLE ||
+		       wal_type == WALType::UPDATE_TUPLE;
+	}
+
 	void ReplayEntry(WALType wal_type);
 
 	void ReplayVersion();
@@ -217,18 +522,40 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	// there can be errors in WAL replay because of a corrupt WAL file
 	// in this case we should throw a warning but startup anyway
 	try {
-		while (true) {
-			// read the current entry
-			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
-			if (deserializer.ReplayEntry()) {
-				con.Commit();
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
+		if (checkpoint_state.wal_version == 1) {
+			// old WAL versions are not size-prefixed: we have to deserialize the entries directly from the file
+			while (true) {
+				// read the current entry
+				auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+				if (deserializer.ReplayEntry()) {
+					con.Commit();
+					// check if the file is exhausted
+					if (reader.Finished()) {
+						// we finished reading the file: break
+						break;
+					}
+					con.BeginTransaction();
+				}
+			}
+		} else {
+			// the version marker is not checksummed - replay it directly
+			auto version_deserializer = WriteAheadLogDeserializer::Open(state, reader);
+			version_deserializer.ReplayEntry();
+
+			// the remaining entries are read and verified ahead of time by the prefetcher
+			WALEntryPrefetcher prefetcher(reader);
+			WALEntryData entry;
+			while (prefetcher.Next(entry)) {
+				auto deserializer = WriteAheadLogDeserializer::Open(state, entry);
+				if (deserializer.ReplayEntry()) {
+					con.Commit();
+					con.BeginTransaction();
 				}
-				con.BeginTransaction();
 			}
+			// we finished reading the file
+			// any entries after the final flush belong to a transaction that was never committed
+			state.AbortAppend();
+			con.Rollback();
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		ErrorData error(ex);
@@ -237,10 +564,12 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			Printer::PrintF("Exception in WAL playback: %s\n", error.RawMessage());
 			// exception thrown in WAL replay: rollback
 		}
+		state.AbortAppend();
 		con.Rollback();
 	} catch (...) {
 		Printer::Print("Unknown Exception in WAL playback: %s\n");
 		// exception thrown in WAL replay: rollback
+		state.AbortAppend();
 		con.Rollback();
 	} // LCOV_EXCL_STOP
 	return false;
@@ -659,7 +988,7 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 	}
 
 	// append to the current table
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk);
+	state.Append(chunk);
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
@@ -46,6 +46,7 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"buffer_eviction_policy", {"lru"}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
@@ -58,6 +59,9 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"debug_force_external", {Value(true)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
+	    {"merge_join_threshold", {Value::UBIGINT(42)}},
+	    {"prefer_index_joins", {true}},
+	    {"hash_join_layout", {"linear_probing"}},
 	    {"allow_persistent_secrets", {Value(false)}},
 	    {"secret_directory", {"/tmp/some/path"}},
 	    {"default_secret_storage", {"custom_storage"}},
@@ -107,6 +111,13 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"enable_http_metadata_cache", {true}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
+	    {"enable_work_stealing", {true}},
+	    {"enable_numa_awareness", {true}},
+	    {"query_priority", {Value::BIGINT(42)}},
+	    {"query_weight", {Value::UBIGINT(42)}},
+	    {"max_memory_intensive_queries", {Value::UBIGINT(42)}},
+	    {"index_scan_percentage", {Value::DOUBLE(0.5)}},
+	    {"index_scan_max_count", {Value::UBIGINT(42)}},
 	    {"arrow_large_buffer_size", {true}}};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
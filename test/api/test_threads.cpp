@@ -1,6 +1,9 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include <chrono>
 #include <thread>
 
 using namespace duckdb;
@@ -115,3 +118,99 @@ TEST_CASE("Test external threads", "[api]") {
 	REQUIRE(config.options.maximum_threads == std::thread::hardware_concurrency());
 	REQUIRE(db.NumberOfThreads() == std::thread::hardware_concurrency());
 }
+
+class RecordingTask : public Task {
+public:
+	RecordingTask(duckdb::vector<idx_t> &log, idx_t id) : log(log), id(id) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		log.push_back(id);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	duckdb::vector<idx_t> &log;
+	idx_t id;
+};
+
+TEST_CASE("Test fair share scheduling of producers with priorities and weights", "[api]") {
+	// no background threads: all tasks are executed by this thread in the order the scheduler hands them out
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	DuckDB db(nullptr, &config);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+	std::atomic<bool> marker(true);
+	duckdb::vector<idx_t> log;
+
+	// tasks of producers with a higher priority are executed first
+	{
+		auto low = scheduler.CreateProducer(0, 1);
+		auto high = scheduler.CreateProducer(1, 1);
+		for (idx_t i = 0; i < 4; i++) {
+			scheduler.ScheduleTask(*low, make_shared<RecordingTask>(log, 0));
+		}
+		for (idx_t i = 0; i < 4; i++) {
+			scheduler.ScheduleTask(*high, make_shared<RecordingTask>(log, 1));
+		}
+		REQUIRE(scheduler.ExecuteTasks(&marker, 8) == 8);
+		REQUIRE(log == duckdb::vector<idx_t> {1, 1, 1, 1, 0, 0, 0, 0});
+	}
+
+	// producers with the same priority receive tasks in proportion to their weight
+	log.clear();
+	{
+		auto heavy = scheduler.CreateProducer(0, 3);
+		auto light = scheduler.CreateProducer(0, 1);
+		for (idx_t i = 0; i < 8; i++) {
+			scheduler.ScheduleTask(*heavy, make_shared<RecordingTask>(log, 0));
+			scheduler.ScheduleTask(*light, make_shared<RecordingTask>(log, 1));
+		}
+		REQUIRE(scheduler.ExecuteTasks(&marker, 8) == 8);
+		REQUIRE(std::count(log.begin(), log.end(), 0) == 6);
+		REQUIRE(std::count(log.begin(), log.end(), 1) == 2);
+
+		// once the heavy producer runs out of tasks, the light producer gets all of them
+		REQUIRE(scheduler.ExecuteTasks(&marker, 8) == 8);
+		REQUIRE(std::count(log.begin(), log.end(), 0) == 8);
+		REQUIRE(std::count(log.begin(), log.end(), 1) == 8);
+		REQUIRE(scheduler.ExecuteTasks(&marker, 1) == 0);
+	}
+}
+
+TEST_CASE("Test admission control of memory-intensive queries", "[api]") {
+	DuckDB db(nullptr);
+	Connection con1(db);
+	Connection con2(db);
+	REQUIRE_NO_FAIL(con1.Query("SET GLOBAL max_memory_intensive_queries=1"));
+	auto &manager = TemporaryMemoryManager::Get(*con1.context);
+
+	auto first = manager.Admit(*con1.context);
+	// nested queries of a client that was already admitted do not wait
+	auto nested = manager.Admit(*con1.context);
+	nested.reset();
+
+	// the second client waits until the first one is done
+	std::atomic<bool> admitted(false);
+	std::thread waiter([&]() {
+		auto second = manager.Admit(*con2.context);
+		admitted = true;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	REQUIRE(!admitted);
+	first.reset();
+	waiter.join();
+	REQUIRE(admitted);
+
+	// a waiting client can be interrupted
+	first = manager.Admit(*con1.context);
+	con2.context->interrupted = true;
+	REQUIRE_THROWS(manager.Admit(*con2.context));
+	con2.context->interrupted = false;
+	first.reset();
+
+	// without a limit, all clients are admitted right away
+	REQUIRE_NO_FAIL(con1.Query("SET GLOBAL max_memory_intensive_queries=0"));
+	first = manager.Admit(*con1.context);
+	auto second = manager.Admit(*con2.context);
+}